@@ -73,12 +73,15 @@ geocode/baseband.h
 geocode/geocodeSlc.h
 geocode/interpolate.h
 geocode/loadDem.h
+geometry/BlockMemory.h
 geometry/DEMInterpolator.h
+geometry/DEMTileCache.h
 geometry/forward.h
 geometry/Shapes.h
 geometry/boundingbox.h
 geometry/Geo2rdr.h
 geometry/Geo2rdr.icc
+geometry/GeoGridBlocks.h
 geometry/Geocode.h
 geometry/Geocode.icc
 geometry/geometry.h
@@ -92,6 +95,8 @@ image/ResampSlc.h
 image/ResampSlc.icc
 image/Tile.h
 image/Tile.icc
+io/ConcurrentRasterReader.h
+io/ConcurrentRasterReader.icc
 io/Constants.h
 io/forward.h
 io/gdal/Buffer.h
@@ -110,9 +115,15 @@ io/gdal/SpatialReference.h
 io/IH5Dataset.h
 io/IH5.h
 io/IH5.icc
+io/IH5ChunkWriter.h
+io/IH5ChunkWriter.icc
+io/OverviewBuilder.h
+io/OverviewBuilder.icc
 io/Raster.h
 io/Raster.icc
 io/Serialization.h
+io/SlidingWindowCache.h
+io/SlidingWindowCache.icc
 matchtemplate/ampcor/correlators/correlators.h
 matchtemplate/ampcor/correlators/kernels.h
 matchtemplate/ampcor/correlators/Sequential.h
@@ -38,19 +38,25 @@ geocode/baseband.cpp
 geocode/geocodeSlc.cpp
 geocode/interpolate.cpp
 geocode/loadDem.cpp
+geometry/BlockMemory.cpp
 geometry/DEMInterpolator.cpp
+geometry/DEMTileCache.cpp
 geometry/Geo2rdr.cpp
+geometry/GeoGridBlocks.cpp
 geometry/Geocode.cpp
 geometry/geometry.cpp
 geometry/RTC.cpp
 geometry/Topo.cpp
 image/ResampSlc.cpp
+io/ConcurrentRasterReader.cpp
 io/gdal/Dataset.cpp
 io/gdal/detail/MemoryMap.cpp
 io/gdal/GeoTransform.cpp
 io/gdal/SpatialReference.cpp
 io/IH5.cpp
+io/IH5ChunkWriter.cpp
 io/IH5Dataset.cpp
+io/OverviewBuilder.cpp
 io/Raster.cpp
 matchtemplate/ampcor/correlators/c2r.cpp
 matchtemplate/ampcor/correlators/correlate.cpp
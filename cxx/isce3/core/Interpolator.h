@@ -7,7 +7,10 @@
 
 #include "forward.h"
 
+#include <complex>
+#include <utility>
 #include <valarray>
+#include <vector>
 
 #include "Constants.h"
 #include "EMatrix.h"
@@ -29,6 +32,16 @@ protected:
     /** Base implementation for all types */
     virtual U interp_impl(double x, double y, const Map& map) const = 0;
 
+    /** Batch implementation, calling interp_impl at each coordinate. The
+     * interpolators override it with a statically dispatched loop. */
+    virtual void interp_batch_impl(const double* x, const double* y,
+                                   size_t n, const Map& map, U* out) const
+    {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = interp_impl(x[i], y[i], map);
+        }
+    }
+
 public:
 
     /** Interpolate at a given coordinate for an input Eigen::Map */
@@ -63,6 +76,30 @@ public:
         return interp_impl(x, y, z);
     }
 
+    /** Interpolate at a batch of coordinates for an input Eigen::Map
+     *
+     * The interpolator is dispatched once for the whole batch instead of
+     * once per coordinate.
+     *
+     * @param[in]  x   X-coordinates to interpolate
+     * @param[in]  y   Y-coordinates to interpolate
+     * @param[in]  n   Number of coordinates
+     * @param[in]  map 2D data to interpolate
+     * @param[out] out Interpolated values */
+    void interpolate(const double* x, const double* y, size_t n,
+                     const Map& map, U* out) const
+    {
+        interp_batch_impl(x, y, n, map, out);
+    }
+
+    /** Interpolate at a batch of coordinates for an input
+     * isce3::core::Matrix */
+    void interpolate(const double* x, const double* y, size_t n,
+                     const Matrix<U>& z, U* out) const
+    {
+        interp_batch_impl(x, y, n, z.map(), out);
+    }
+
     /** Return interpolation method. */
     dataInterpMethod method() const { return _method; }
 
@@ -74,7 +111,8 @@ protected:
 
 /** Definition of BilinearInterpolator */
 template<typename U>
-class isce3::core::BilinearInterpolator : public isce3::core::Interpolator<U> {
+class isce3::core::BilinearInterpolator final :
+    public isce3::core::Interpolator<U> {
 
     using super_t = Interpolator<U>;
     using typename super_t::Map;
@@ -82,6 +120,10 @@ class isce3::core::BilinearInterpolator : public isce3::core::Interpolator<U> {
     /** Interpolate at a given coordinate. */
     U interp_impl(double x, double y, const Map& z) const override;
 
+    /** Interpolate at a batch of coordinates. */
+    void interp_batch_impl(const double* x, const double* y, size_t n,
+                           const Map& z, U* out) const override;
+
 public:
     /** Default constructor */
     BilinearInterpolator() : super_t {BILINEAR_METHOD} {}
@@ -92,7 +134,8 @@ public:
 
 /** Definition of BicubicInterpolator */
 template<typename U>
-class isce3::core::BicubicInterpolator : public isce3::core::Interpolator<U> {
+class isce3::core::BicubicInterpolator final :
+    public isce3::core::Interpolator<U> {
 
     using super_t = Interpolator<U>;
     using typename super_t::Map;
@@ -100,6 +143,10 @@ class isce3::core::BicubicInterpolator : public isce3::core::Interpolator<U> {
     /** Interpolate at a given coordinate. */
     U interp_impl(double x, double y, const Map& z) const override;
 
+    /** Interpolate at a batch of coordinates. */
+    void interp_batch_impl(const double* x, const double* y, size_t n,
+                           const Map& z, U* out) const override;
+
 public:
     /** Default constructor */
     BicubicInterpolator() : super_t {BICUBIC_METHOD} {}
@@ -110,7 +157,7 @@ public:
 
 /** Definition of NearestNeighborInterpolator */
 template<typename U>
-class isce3::core::NearestNeighborInterpolator :
+class isce3::core::NearestNeighborInterpolator final :
     public isce3::core::Interpolator<U> {
 
     using super_t = Interpolator<U>;
@@ -119,6 +166,10 @@ class isce3::core::NearestNeighborInterpolator :
     /** Interpolate at a given coordinate. */
     U interp_impl(double x, double y, const Map& z) const override;
 
+    /** Interpolate at a batch of coordinates. */
+    void interp_batch_impl(const double* x, const double* y, size_t n,
+                           const Map& z, U* out) const override;
+
 public:
     /** Default constructor */
     NearestNeighborInterpolator() : super_t {NEAREST_METHOD} {}
@@ -129,7 +180,8 @@ public:
 
 /** Definition of Spline2dInterpolator */
 template<typename U>
-class isce3::core::Spline2dInterpolator : public isce3::core::Interpolator<U> {
+class isce3::core::Spline2dInterpolator final :
+    public isce3::core::Interpolator<U> {
 
     using super_t = Interpolator<U>;
     using typename super_t::Map;
@@ -141,6 +193,10 @@ public:
     /** Interpolate at a given coordinate. */
     U interp_impl(double x, double y, const Map& z) const override;
 
+    /** Interpolate at a batch of coordinates. */
+    void interp_batch_impl(const double* x, const double* y, size_t n,
+                           const Map& z, U* out) const override;
+
     // Inherit overloads for other datatypes
     using super_t::interpolate;
 
@@ -159,7 +215,8 @@ private:
 
 /** Definition of Sinc2dInterpolator */
 template<typename U>
-class isce3::core::Sinc2dInterpolator : public isce3::core::Interpolator<U> {
+class isce3::core::Sinc2dInterpolator final :
+    public isce3::core::Interpolator<U> {
 
     using super_t = Interpolator<U>;
     using typename super_t::Map;
@@ -167,6 +224,10 @@ class isce3::core::Sinc2dInterpolator : public isce3::core::Interpolator<U> {
     /** Interpolate at a given coordinate. */
     U interp_impl(double x, double y, const Map& z) const override;
 
+    /** Interpolate at a batch of coordinates. */
+    void interp_batch_impl(const double* x, const double* y, size_t n,
+                           const Map& z, U* out) const override;
+
 public:
     /** Default constructor. */
     Sinc2dInterpolator(int sincLen, int sincSub);
@@ -184,8 +245,13 @@ private:
     U _sinc_eval_2d(const Map& z, int intpx, int intpy, double frpx,
                     double frpy) const;
 
+    // Real type of the data, to weight samples without complex products
+    using real_t = decltype(std::abs(std::declval<U>()));
+
 private:
-    Matrix<double> _kernel;
+    // Normalized coefficients of each fractional offset, in the order of
+    // the samples of the chip (first to last)
+    std::vector<real_t> _kernel;
     int _kernelLength, _kernelWidth, _sincHalf;
 };
 
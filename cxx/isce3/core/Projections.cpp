@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -14,6 +16,7 @@ using isce3::core::LonLat;
 using isce3::core::PolarStereo;
 using isce3::core::ProjectionBase;
 using isce3::core::UTM;
+using isce3::core::Vec3;
 using std::cout;
 using std::endl;
 using std::invalid_argument;
@@ -21,6 +24,68 @@ using std::string;
 using std::to_string;
 using std::vector;
 
+/* * * * * * * * * * * * * * * * * * * * Batch Transforms * * * * * * * * * * * * * * * * * * * */
+template<class Transform>
+static int transformPoints(Transform transform, const double *in0, const double *in1,
+                           const double *in2, double *out0, double *out1, double *out2,
+                           size_t n) {
+    /*
+     * Local function - Apply a point transform to arrays of points. Projections pass their
+     * own transform, qualified so that it is called without virtual dispatch and can be
+     * inlined in the loop.
+     */
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    int failed = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const Vec3 in{in0[i], in1[i], in2[i]};
+        Vec3 out;
+        if (transform(in, out) != 0) {
+            out0[i] = out1[i] = out2[i] = nan;
+            ++failed;
+            continue;
+        }
+        out0[i] = out[0];
+        out1[i] = out[1];
+        out2[i] = out[2];
+    }
+    return failed;
+}
+
+int ProjectionBase::forward(const double *lon, const double *lat, const double *h,
+                            double *x, double *y, double *z, size_t n) const {
+    return transformPoints([this](const Vec3 &in, Vec3 &out) { return forward(in, out); },
+                           lon, lat, h, x, y, z, n);
+}
+
+int ProjectionBase::inverse(const double *x, const double *y, const double *z,
+                            double *lon, double *lat, double *h, size_t n) const {
+    return transformPoints([this](const Vec3 &in, Vec3 &out) { return inverse(in, out); },
+                           x, y, z, lon, lat, h, n);
+}
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* * * * * * * * * * * * * * * * * * * * LonLat Projection * * * * * * * * * * * * * * * * * * * */
+int LonLat::forward(const double *lon, const double *lat, const double *h,
+                    double *x, double *y, double *z, size_t n) const {
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = lon[i] * 180.0/M_PI;
+        y[i] = lat[i] * 180.0/M_PI;
+        z[i] = h[i];
+    }
+    return 0;
+}
+
+int LonLat::inverse(const double *x, const double *y, const double *z,
+                    double *lon, double *lat, double *h, size_t n) const {
+    for (size_t i = 0; i < n; ++i) {
+        lon[i] = x[i] * M_PI/180.0;
+        lat[i] = y[i] * M_PI/180.0;
+        h[i] = z[i];
+    }
+    return 0;
+}
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
 /* * * * * * * * * * * * * * * * * * * * Geocent Projection * * * * * * * * * * * * * * * * * * * */
 int Geocent::forward(const cartesian_t &llh, cartesian_t& xyz) const {
     /*
@@ -40,6 +105,20 @@ int Geocent::inverse(const cartesian_t &xyz, cartesian_t& llh) const {
     ellipsoid().xyzToLonLat(xyz, llh);
     return 0;
 }
+
+int Geocent::forward(const double *lon, const double *lat, const double *h,
+                     double *x, double *y, double *z, size_t n) const {
+    return transformPoints(
+            [this](const Vec3 &in, Vec3 &out) { return Geocent::forward(in, out); },
+            lon, lat, h, x, y, z, n);
+}
+
+int Geocent::inverse(const double *x, const double *y, const double *z,
+                     double *lon, double *lat, double *h, size_t n) const {
+    return transformPoints(
+            [this](const Vec3 &in, Vec3 &out) { return Geocent::inverse(in, out); },
+            x, y, z, lon, lat, h, n);
+}
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 /* * * * * * * * * * * * * * * * * * * * * UTM Projection * * * * * * * * * * * * * * * * * * * * */
@@ -53,10 +132,12 @@ double clens(const double *a, int size, double real) {
      */
     const double *p;
     double hr, hr1, hr2;
+    // Trigonometric terms are evaluated once rather than at every step of the recurrence
+    const double cosr = cos(real);
     for (p = a + size, hr2 = 0., hr1 = *(--p), hr=0.;
          a - p;
          hr2 = hr1, hr1 = hr) {
-        hr = -hr2 + (2. * hr1 * cos(real)) + *(--p);
+        hr = -hr2 + (2. * hr1 * cosr) + *(--p);
     }
     return sin(real) * hr;
 }
@@ -72,18 +153,19 @@ double clenS(const double *a, int size, double real, double imag, double &R, dou
      */
     const double *p;
     double hr, hr1, hr2, hi, hi1, hi2;
+    const double sinr = sin(real), cosr = cos(real);
+    const double sinhi = sinh(imag), coshi = cosh(imag);
     for (p = a + size, hr2 = 0., hi2 = 0., hi1 = 0., hr1 = *(--p), hi1 = 0., hr = 0., hi = 0.;
          a - p;
          hr2 = hr1, hi2 = hi1, hr1 = hr, hi1 = hi) {
-        hr = -hr2 + (2. * hr1 * cos(real) * cosh(imag)) - (-2. * hi1 * sin(real) * sinh(imag)) +
-             *(--p);
-        hi = -hi2 + (-2. * hr1 * sin(real) * sinh(imag)) + (2. * hi1 * cos(real) * cosh(imag));
+        hr = -hr2 + (2. * hr1 * cosr * coshi) - (-2. * hi1 * sinr * sinhi) + *(--p);
+        hi = -hi2 + (-2. * hr1 * sinr * sinhi) + (2. * hi1 * cosr * coshi);
     }
     // Bad practice - Should *either* modify R in-place *or* return R, not both. I is modified, but
     // not returned. Since R and I are tied, we should either return a pair<,>(,) or modify
     // in-place, not mix the strategies
-    R = (sin(real) * cosh(imag) * hr) - (cos(real) * sinh(imag) * hi);
-    I = (sin(real) * cosh(imag) * hi) + (cos(real) * sinh(imag) * hr);
+    R = (sinr * coshi * hr) - (cosr * sinhi * hi);
+    I = (sinr * coshi * hi) + (cosr * sinhi * hr);
     return R;
 }
 
@@ -177,8 +259,9 @@ int UTM::forward(const cartesian_t &llh, cartesian_t &utm) const {
     double lam = llh[0] - lon0;
 
     // Account for longitude and get Spherical N,E
-    double Cn = atan2(sin(gauss), cos(lam)*cos(gauss));
-    double Ce = atan2(sin(lam)*cos(gauss), hypot(sin(gauss), cos(gauss)*cos(lam)));
+    const double singauss = sin(gauss), cosgauss = cos(gauss), coslam = cos(lam);
+    double Cn = atan2(singauss, coslam*cosgauss);
+    double Ce = atan2(sin(lam)*cosgauss, hypot(singauss, cosgauss*coslam));
 
     //Spherical N,E to Elliptical N,E
     Ce = asinh(tan(Ce));
@@ -217,8 +300,9 @@ int UTM::inverse(const cartesian_t &utm, cartesian_t &llh) const {
         //Spherical Lat, Lon to Gaussian Lat, Lon
         double sinCe = sin(Ce);
         double cosCe = cos(Ce);
-        Ce = atan2(sinCe, cosCe*cos(Cn));
-        Cn = atan2(sin(Cn)*cosCe, hypot(sinCe, cosCe*cos(Cn)));
+        const double cosCn = cos(Cn);
+        Ce = atan2(sinCe, cosCe*cosCn);
+        Cn = atan2(sin(Cn)*cosCe, hypot(sinCe, cosCe*cosCn));
 
         //Gaussian Lat, Lon to Elliptical Lat, Lon
         llh[0] = Ce + lon0;
@@ -230,6 +314,20 @@ int UTM::inverse(const cartesian_t &utm, cartesian_t &llh) const {
         return 1;
     }
 }
+
+int UTM::forward(const double *lon, const double *lat, const double *h,
+                  double *x, double *y, double *z, size_t n) const {
+    return transformPoints(
+            [this](const Vec3 &in, Vec3 &out) { return UTM::forward(in, out); },
+            lon, lat, h, x, y, z, n);
+}
+
+int UTM::inverse(const double *x, const double *y, const double *z,
+                  double *lon, double *lat, double *h, size_t n) const {
+    return transformPoints(
+            [this](const Vec3 &in, Vec3 &out) { return UTM::inverse(in, out); },
+            x, y, z, lon, lat, h, n);
+}
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 /* * * * * * * * * * * * * * * * * * * PolarStereo Projection * * * * * * * * * * * * * * * * * * */
@@ -308,6 +406,20 @@ int PolarStereo::inverse(const cartesian_t &ups, cartesian_t &llh) const {
     }
     return 1;
 }
+
+int PolarStereo::forward(const double *lon, const double *lat, const double *h,
+                          double *x, double *y, double *z, size_t n) const {
+    return transformPoints(
+            [this](const Vec3 &in, Vec3 &out) { return PolarStereo::forward(in, out); },
+            lon, lat, h, x, y, z, n);
+}
+
+int PolarStereo::inverse(const double *x, const double *y, const double *z,
+                          double *lon, double *lat, double *h, size_t n) const {
+    return transformPoints(
+            [this](const Vec3 &in, Vec3 &out) { return PolarStereo::inverse(in, out); },
+            x, y, z, lon, lat, h, n);
+}
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 /* * * * * * * * * * * * * * * * * * * * * CEA Projection * * * * * * * * * * * * * * * * * * * * */
@@ -354,6 +466,20 @@ int CEA::inverse(const cartesian_t &enu, cartesian_t &llh) const {
     llh[2] = enu[2];
     return 0;
 }
+
+int CEA::forward(const double *lon, const double *lat, const double *h,
+                  double *x, double *y, double *z, size_t n) const {
+    return transformPoints(
+            [this](const Vec3 &in, Vec3 &out) { return CEA::forward(in, out); },
+            lon, lat, h, x, y, z, n);
+}
+
+int CEA::inverse(const double *x, const double *y, const double *z,
+                  double *lon, double *lat, double *h, size_t n) const {
+    return transformPoints(
+            [this](const Vec3 &in, Vec3 &out) { return CEA::inverse(in, out); },
+            x, y, z, lon, lat, h, n);
+}
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 /* * * * * * * * * * * * * * * * * * * Projection Factory * * * * * * * * * * * * * * * * * * */
@@ -406,3 +532,36 @@ int isce3::core::projTransform(ProjectionBase *in, ProjectionBase *out, const is
     return 0;
 }
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* * * * * * * * * * * * * * * * * * * Batch Projection Transformer * * * * * * * * * * * * * * */
+int isce3::core::projTransform(ProjectionBase *in, ProjectionBase *out, const double *xin,
+                               const double *yin, const double *zin, double *xout,
+                               double *yout, double *zout, size_t n) {
+    if (in->code() == out->code()) {
+        // If input/output projections are the same don't even bother processing
+        std::copy(xin, xin + n, xout);
+        std::copy(yin, yin + n, yout);
+        std::copy(zin, zin + n, zout);
+        return 0;
+    }
+
+    // Go through LLH in chunks that stay in cache
+    constexpr size_t chunk = 256;
+    double lon[chunk], lat[chunk], h[chunk];
+    for (size_t start = 0; start < n; start += chunk) {
+        const size_t count = std::min(chunk, n - start);
+        in->inverse(xin + start, yin + start, zin + start, lon, lat, h, count);
+        out->forward(lon, lat, h, xout + start, yout + start, zout + start, count);
+    }
+
+    // Points that failed either transform are NaN. Count them once, as the
+    // forward transform of a point that failed the inverse may fail too.
+    int failed = 0;
+    for (size_t i = 0; i < n; ++i) {
+        if (std::isnan(xout[i]) || std::isnan(yout[i]) || std::isnan(zout[i])) {
+            ++failed;
+        }
+    }
+    return failed;
+}
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
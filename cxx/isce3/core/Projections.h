@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <iostream>
 #include <memory>
 
@@ -59,6 +60,38 @@ namespace isce3 { namespace core {
             return llh;
         }
 
+        /** Transform arrays of points from LLH
+         *
+         * Points that cannot be transformed are set to NaN.
+         *
+         * @param[in] lon Longitudes (radians)
+         * @param[in] lat Latitudes (radians)
+         * @param[in] h Heights
+         * @param[out] x X coordinates in specified projection system
+         * @param[out] y Y coordinates in specified projection system
+         * @param[out] z Z coordinates in specified projection system
+         * @param[in] n Number of points
+         * @returns Number of points that could not be transformed */
+        virtual int forward(const double* lon, const double* lat,
+                            const double* h, double* x, double* y, double* z,
+                            size_t n) const;
+
+        /** Transform arrays of points to LLH
+         *
+         * Points that cannot be transformed are set to NaN.
+         *
+         * @param[in] x X coordinates in specified projection system
+         * @param[in] y Y coordinates in specified projection system
+         * @param[in] z Z coordinates in specified projection system
+         * @param[out] lon Longitudes (radians)
+         * @param[out] lat Latitudes (radians)
+         * @param[out] h Heights
+         * @param[in] n Number of points
+         * @returns Number of points that could not be transformed */
+        virtual int inverse(const double* x, const double* y, const double* z,
+                            double* lon, double* lat, double* h,
+                            size_t n) const;
+
         /** Virtual destructor */
         virtual ~ProjectionBase() {}
     };
@@ -74,6 +107,13 @@ namespace isce3 { namespace core {
         inline int forward(const cartesian_t&, cartesian_t&) const;
         // This will also be a pass through for Lat/Lon
         inline int inverse(const cartesian_t&, cartesian_t&) const;
+
+        using ProjectionBase::forward;
+        using ProjectionBase::inverse;
+        int forward(const double*, const double*, const double*, double*,
+                    double*, double*, size_t) const override;
+        int inverse(const double*, const double*, const double*, double*,
+                    double*, double*, size_t) const override;
     };
 
     inline void LonLat::print() const {
@@ -106,6 +146,12 @@ namespace isce3 { namespace core {
 
         /** This is same as Ellipsoid::xyzToLonLat*/
         int inverse(const cartesian_t& xyz,cartesian_t& llh) const;
+        using ProjectionBase::forward;
+        using ProjectionBase::inverse;
+        int forward(const double*, const double*, const double*, double*,
+                    double*, double*, size_t) const override;
+        int inverse(const double*, const double*, const double*, double*,
+                    double*, double*, size_t) const override;
     };
 
     inline void Geocent::print() const {
@@ -135,6 +181,12 @@ namespace isce3 { namespace core {
 
         /** Transform from UTM(m) to llh (rad)*/
         int inverse(const cartesian_t& xyz, cartesian_t& llh) const;
+        using ProjectionBase::forward;
+        using ProjectionBase::inverse;
+        int forward(const double*, const double*, const double*, double*,
+                    double*, double*, size_t) const override;
+        int inverse(const double*, const double*, const double*, double*,
+                    double*, double*, size_t) const override;
     };
 
     inline void UTM::print() const {
@@ -162,6 +214,12 @@ namespace isce3 { namespace core {
 
         /** Transform from Polar Stereo (m) to llh (rad)*/
         int inverse(const cartesian_t&,cartesian_t&) const;
+        using ProjectionBase::forward;
+        using ProjectionBase::inverse;
+        int forward(const double*, const double*, const double*, double*,
+                    double*, double*, size_t) const override;
+        int inverse(const double*, const double*, const double*, double*,
+                    double*, double*, size_t) const override;
     };
 
     inline void PolarStereo::print() const {
@@ -189,6 +247,12 @@ namespace isce3 { namespace core {
 
         /** Transform from CEA (m) to LLH (rad)*/
         int inverse(const cartesian_t& xyz,cartesian_t& llh) const;
+        using ProjectionBase::forward;
+        using ProjectionBase::inverse;
+        int forward(const double*, const double*, const double*, double*,
+                    double*, double*, size_t) const override;
+        int inverse(const double*, const double*, const double*, double*,
+                    double*, double*, size_t) const override;
     };
 
     inline void CEA::print() const {
@@ -208,4 +272,13 @@ namespace isce3 { namespace core {
     // This is to transform a point from one coordinate system to another
     int projTransform(ProjectionBase* in, ProjectionBase *out, const Vec3& inpts,
                       Vec3& outpts);
+
+    /** Transform arrays of points from one coordinate system to another
+     *
+     * Points that cannot be transformed are set to NaN.
+     *
+     * @returns Number of points that could not be transformed */
+    int projTransform(ProjectionBase* in, ProjectionBase* out,
+                      const double* xin, const double* yin, const double* zin,
+                      double* xout, double* yout, double* zout, size_t n);
 }}
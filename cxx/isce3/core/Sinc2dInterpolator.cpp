@@ -19,8 +19,8 @@ Sinc2dInterpolator(int sincLen, int sincSub) :
     std::valarray<double> filter(0.0, sincSub * sincLen);
     _sinc_coef(1.0, sincLen, sincSub, 0.0, 1, filter);
 
-    // Resize member kernel matrix
-    _kernel.resize(sincSub, sincLen);
+    // Resize member kernel table
+    _kernel.resize(sincSub * sincLen);
 
     // Normalize filter
     for (size_t i = 0; i < sincSub; ++i) {
@@ -29,10 +29,11 @@ Sinc2dInterpolator(int sincLen, int sincSub) :
         for (size_t j = 0; j < sincLen; ++j) {
             ssum += filter[i + sincSub*j];
         }
-        // Normalize the filter coefficients and copy to transposed member kernel
+        // Normalize the filter coefficients and copy them in reverse order
+        // to the member kernel, matching the samples of the chip
         for (size_t j = 0; j < sincLen; ++j) {
             filter[i + sincSub*j] /= ssum;
-            _kernel(i,j) = filter[i + sincSub*j];
+            _kernel[i*sincLen + sincLen - 1 - j] = filter[i + sincSub*j];
         }
     }
 }
@@ -67,30 +68,51 @@ U isce3::core::Sinc2dInterpolator<U>::interp_impl(double x, double y,
     return interpVal;
 }
 
+// Separable sinc evaluation: filter the lines of the chip with the x kernel,
+// then the filtered column with the y kernel. The kernel length N is fixed
+// at compile time for the common lengths so that the loops are unrolled and
+// vectorized, or 0 to use the run-time length.
+template<int N, typename U, typename R>
+static U sincEvalSeparable(const U* chip, Eigen::Index stride, const R* kx,
+                           const R* ky, int length)
+{
+    const int n = (N > 0) ? N : length;
+    U ret(0.0);
+    for (int i = 0; i < n; ++i) {
+        const U* line = chip + i * stride;
+        U sum(0.0);
+        for (int j = 0; j < n; ++j) {
+            sum += line[j] * kx[j];
+        }
+        ret += sum * ky[i];
+    }
+    return ret;
+}
+
 template<class U>
 U isce3::core::Sinc2dInterpolator<U>::_sinc_eval_2d(const Map& arrin, int intpx,
                                                    int intpy, double frpx,
                                                    double frpy) const
 {
-
-    // Initialize return value
-    U ret(0.0);
-    
     // Get nearest kernel indices
     int ifracx = std::min(std::max(0, int(frpx*_kernelLength)), _kernelLength-1);
     int ifracy = std::min(std::max(0, int(frpy*_kernelLength)), _kernelLength-1);
-
-    // Compute weighted sum from kernel
-    for (int i = 0; i < _kernelWidth; i++) {
-        for (int j = 0; j < _kernelWidth; j++) {
-            ret += arrin(intpy-i,intpx-j) * 
-                   static_cast<U>(_kernel(ifracy,i)) * 
-                   static_cast<U>(_kernel(ifracx,j));
-        }
+    const real_t* kx = &_kernel[ifracx * _kernelWidth];
+    const real_t* ky = &_kernel[ifracy * _kernelWidth];
+
+    // First sample of the chip ending at (intpy, intpx)
+    const Eigen::Index stride = arrin.outerStride();
+    const U* chip = arrin.data() + (intpy - _kernelWidth + 1) * stride +
+                    (intpx - _kernelWidth + 1);
+
+    switch (_kernelWidth) {
+    case 8:
+        return sincEvalSeparable<8>(chip, stride, kx, ky, _kernelWidth);
+    case 16:
+        return sincEvalSeparable<16>(chip, stride, kx, ky, _kernelWidth);
+    default:
+        return sincEvalSeparable<0>(chip, stride, kx, ky, _kernelWidth);
     }
-
-    // Done
-    return ret;
 }
 
 template<class U>
@@ -112,6 +134,20 @@ void isce3::core::Sinc2dInterpolator<U>::_sinc_coef(
     }
 }
 
+/** @param[in] x X-coordinates to interpolate
+  * @param[in] y Y-coordinates to interpolate
+  * @param[in] n Number of coordinates
+  * @param[in] z 2D matrix to interpolate
+  * @param[out] out Interpolated values */
+template<class U>
+void isce3::core::Sinc2dInterpolator<U>::interp_batch_impl(const double* x,
+        const double* y, size_t n, const Map& z, U* out) const
+{
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = Sinc2dInterpolator::interp_impl(x[i], y[i], z);
+    }
+}
+
 // Forward declaration of classes
 template class isce3::core::Sinc2dInterpolator<double>;
 template class isce3::core::Sinc2dInterpolator<float>;
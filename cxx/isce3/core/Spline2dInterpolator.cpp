@@ -107,6 +107,20 @@ void isce3::core::Spline2dInterpolator<U>::_initSpline(const std::valarray<U>& Y
         R[i] = Q[i] * R[i+1] + R[i];
 }
 
+/** @param[in] x X-coordinates to interpolate
+  * @param[in] y Y-coordinates to interpolate
+  * @param[in] n Number of coordinates
+  * @param[in] z 2D matrix to interpolate
+  * @param[out] out Interpolated values */
+template<class U>
+void isce3::core::Spline2dInterpolator<U>::interp_batch_impl(const double* x,
+        const double* y, size_t n, const Map& z, U* out) const
+{
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = Spline2dInterpolator::interp_impl(x[i], y[i], z);
+    }
+}
+
 // Forward declaration of classes
 template class isce3::core::Spline2dInterpolator<double>;
 template class isce3::core::Spline2dInterpolator<float>;
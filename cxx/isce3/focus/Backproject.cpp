@@ -1,6 +1,8 @@
 #include "Backproject.h"
 
+#include <algorithm>
 #include <cmath>
+#include <future>
 #include <isce3/container/RadarGeometry.h>
 #include <isce3/core/Constants.h>
 #include <isce3/core/Ellipsoid.h>
@@ -10,6 +12,7 @@
 #include <isce3/except/Error.h>
 #include <isce3/geometry/DEMInterpolator.h>
 #include <isce3/geometry/geometry.h>
+#include <isce3/io/Raster.h>
 #include <limits>
 #include <string>
 #include <vector>
@@ -24,25 +27,40 @@ using isce3::container::RadarGeometry;
 namespace isce3 {
 namespace focus {
 
-inline std::complex<float> sumCoherent(const std::complex<float>* data,
-                                       const Linspace<double>& sampling_window,
-                                       const std::vector<Vec3>& pos,
-                                       const std::vector<Vec3>& vel,
-                                       const Vec3& x,
-                                       double fc,
-                                       double tau_atm,
-                                       const Kernel<float>& kernel,
-                                       int kstart, int kstop)
+/** Geometry of an output target required to integrate its echoes */
+struct TargetGeometry {
+    Vec3 x;         // target position in ECEF coordinates (m)
+    double tau_atm; // dry troposphere delay (s)
+    int kstart;     // coherent processing window start pulse (inclusive)
+    int kstop;      // coherent processing window end pulse (exclusive)
+};
+
+/**
+ * Accumulate the coherent sum of echoes from target \p x over pulses
+ * [ \p kstart , \p kstop ).
+ *
+ * \p data points to the range-compressed data of pulse \p k0, so that pulse
+ * k is stored in line (k - k0).
+ */
+inline void accumulateCoherent(std::complex<double>* sum,
+                               const std::complex<float>* data, int k0,
+                               const Linspace<double>& sampling_window,
+                               const std::vector<Vec3>& pos,
+                               const std::vector<Vec3>& vel,
+                               const Vec3& x,
+                               double fc,
+                               double tau_atm,
+                               const Kernel<float>& kernel,
+                               int kstart, int kstop)
 {
     // loop over pulses within integration window
-    std::complex<double> sum(0., 0.);
     for (int k = kstart; k < kstop; ++k) {
 
         // compute round-trip delay to target
         double tau = tau_atm + bistaticDelay(pos[k], vel[k], x);
 
         // interpolate range-compressed data
-        auto data_line = &data[size_t(k) * sampling_window.size()];
+        auto data_line = &data[size_t(k - k0) * sampling_window.size()];
         double u = (tau - sampling_window.first()) / sampling_window.spacing();
         std::complex<double> s =
                 interp1d(kernel, data_line, sampling_window.size(), 1, u);
@@ -53,27 +71,118 @@ inline std::complex<float> sumCoherent(const std::complex<float>* data,
 
         // worst-case numerical error increases linearly, accumulate using
         // double precision to mitigate errors
-        sum += s;
+        *sum += s;
     }
+}
 
+inline std::complex<float> sumCoherent(const std::complex<float>* data,
+                                       const Linspace<double>& sampling_window,
+                                       const std::vector<Vec3>& pos,
+                                       const std::vector<Vec3>& vel,
+                                       const Vec3& x,
+                                       double fc,
+                                       double tau_atm,
+                                       const Kernel<float>& kernel,
+                                       int kstart, int kstop)
+{
+    std::complex<double> sum(0., 0.);
+    accumulateCoherent(&sum, data, 0, sampling_window, pos, vel, x, fc,
+                       tau_atm, kernel, kstart, kstop);
     return std::complex<float>(sum);
 }
 
-void backproject(std::complex<float>* out,
-                 const RadarGeometry& out_geometry,
-                 const std::complex<float>* in,
-                 const RadarGeometry& in_geometry,
-                 const DEMInterpolator& dem,
-                 double fc,
-                 double ds,
-                 const Kernel<float>& kernel,
-                 DryTroposphereModel dry_tropo_model,
-                 const Rdr2GeoParams& r2g_params,
-                 const Geo2RdrParams& g2r_params)
+/**
+ * Estimate the position & coherent processing window of the output target at
+ * azimuth time \p t and slant range \p r.
+ *
+ * On input, \p llh[2] and \p t_in contain the initial guesses for the target
+ * height and input data azimuth time used by rdr2geo and geo2rdr respectively.
+ * On output, they are updated with the converged solutions.
+ *
+ * Returns false if either rdr2geo or geo2rdr failed to converge.
+ */
+inline bool estimateTargetGeometry(TargetGeometry* target,
+                                   Vec3* llh,
+                                   double* t_in,
+                                   double t, double r,
+                                   const RadarGeometry& out_geometry,
+                                   const RadarGeometry& in_geometry,
+                                   const DEMInterpolator& dem,
+                                   const Ellipsoid& ellipsoid,
+                                   double wvl,
+                                   double ds,
+                                   DryTroposphereModel dry_tropo_model,
+                                   const Rdr2GeoParams& r2g_params,
+                                   const Geo2RdrParams& g2r_params)
 {
-    static constexpr double c = isce3::core::speed_of_light;
-    static constexpr auto nan = std::numeric_limits<float>::quiet_NaN();
+    // run rdr2geo using orbit and Doppler associated with output grid
+    // to get target position
+    {
+        double fD = out_geometry.doppler().eval(t, r);
+
+        auto converged = rdr2geo(
+                t, r, fD, out_geometry.orbit(), ellipsoid, dem, *llh, wvl,
+                out_geometry.lookSide(), r2g_params.threshold,
+                r2g_params.maxiter, r2g_params.extraiter);
+
+        if (not converged) {
+            return false;
+        }
+    }
 
+    // run geo2rdr using input data's orbit and azimuth carrier to
+    // estimate the center of the coherent processing window for the
+    // target
+    double r_in;
+    {
+        auto converged = geo2rdr(*llh, ellipsoid, in_geometry.orbit(),
+                                 in_geometry.doppler(), *t_in, r_in, wvl,
+                                 in_geometry.lookSide(), g2r_params.threshold,
+                                 g2r_params.maxiter, g2r_params.delta_range);
+
+        if (not converged) {
+            return false;
+        }
+    }
+
+    // convert target LLH to ECEF coordinates
+    target->x = ellipsoid.lonLatToXyz(*llh);
+
+    // get platform position and velocity at center of CPI
+    Vec3 p, v;
+    in_geometry.orbit().interpolate(&p, &v, *t_in);
+
+    // estimate synthetic aperture length required to achieve the
+    // desired azimuth resolution
+    double l = wvl * r_in * (p.norm() / target->x.norm()) / (2. * ds);
+
+    // approximate CPI duration (assuming constant platform velocity)
+    double cpi = l / v.norm();
+
+    // get coherent integration bounds (pulse indices)
+    const Linspace<double> in_azimuth_time = in_geometry.sensingTime();
+    double tstart = *t_in - 0.5 * cpi;
+    double tstop = *t_in + 0.5 * cpi;
+    double t0 = in_azimuth_time.first();
+    double dt = in_azimuth_time.spacing();
+    auto kstart = static_cast<int>(std::floor((tstart - t0) / dt));
+    auto kstop = static_cast<int>(std::ceil((tstop - t0) / dt));
+    target->kstart = std::max(kstart, 0);
+    target->kstop = std::min(kstop, in_azimuth_time.size());
+
+    // estimate dry troposphere delay
+    target->tau_atm = 0.;
+    if (dry_tropo_model == DryTroposphereModel::TSX) {
+        target->tau_atm = dryTropoDelayTSX(p, *llh, ellipsoid);
+    }
+
+    return true;
+}
+
+inline void checkBackprojectInputs(const RadarGeometry& out_geometry,
+                                   const RadarGeometry& in_geometry,
+                                   DryTroposphereModel dry_tropo_model)
+{
     // check that dry_tropo_model is supported internally
     if (not(dry_tropo_model == DryTroposphereModel::NoDelay or
             dry_tropo_model == DryTroposphereModel::TSX)) {
@@ -90,6 +199,198 @@ void backproject(std::complex<float>* out,
                              "reference epoch";
         throw isce3::except::RuntimeError(ISCE_SRCINFO(), errmsg);
     }
+}
+
+/** Bounds of a rectangular tile of the output grid */
+struct Tile {
+    int j0;      // first azimuth line
+    int i0;      // first range sample
+    int lines;   // number of azimuth lines
+    int samples; // number of range samples
+
+    int size() const { return lines * samples; }
+};
+
+/**
+ * Estimate the geometry of each target in an output tile.
+ *
+ * Each rdr2geo/geo2rdr solution is seeded with the solution from the
+ * neighboring target (the previous sample in the same line, or the first
+ * sample of the previous line). Targets whose solution did not converge are
+ * flagged as invalid.
+ *
+ * Returns false if any target in the tile failed to converge.
+ */
+inline bool estimateTileGeometry(TargetGeometry* targets,
+                                 char* valid,
+                                 const Tile& tile,
+                                 const RadarGeometry& out_geometry,
+                                 const RadarGeometry& in_geometry,
+                                 const DEMInterpolator& dem,
+                                 const Ellipsoid& ellipsoid,
+                                 double wvl,
+                                 double ds,
+                                 DryTroposphereModel dry_tropo_model,
+                                 const Rdr2GeoParams& r2g_params,
+                                 const Geo2RdrParams& g2r_params)
+{
+    const Linspace<double> out_azimuth_time = out_geometry.sensingTime();
+    const Linspace<double> out_slant_range = out_geometry.slantRange();
+    const double t_mid = in_geometry.radarGrid().sensingMid();
+
+    bool all_converged = true;
+
+    Vec3 llh_first;
+    double t_first = t_mid;
+    bool first_valid = false;
+
+    for (int jj = 0; jj < tile.lines; ++jj) {
+        Vec3 llh;
+        llh[2] = 0.;
+        double t = t_mid;
+        bool seeded = false;
+        if (first_valid) {
+            llh = llh_first;
+            t = t_first;
+            seeded = true;
+        }
+
+        for (int ii = 0; ii < tile.samples; ++ii) {
+            const int idx = jj * tile.samples + ii;
+
+            // fall back to default initial guesses if the neighboring
+            // target did not converge
+            if (not seeded) {
+                llh[2] = 0.;
+                t = t_mid;
+            }
+
+            seeded = estimateTargetGeometry(
+                    &targets[idx], &llh, &t, out_azimuth_time[tile.j0 + jj],
+                    out_slant_range[tile.i0 + ii], out_geometry, in_geometry,
+                    dem, ellipsoid, wvl, ds, dry_tropo_model, r2g_params,
+                    g2r_params);
+
+            valid[idx] = seeded;
+            if (not seeded) {
+                all_converged = false;
+            }
+
+            if (ii == 0) {
+                first_valid = seeded;
+                llh_first = llh;
+                t_first = t;
+            }
+        }
+    }
+
+    return all_converged;
+}
+
+/**
+ * Get the union [ \p kmin , \p kmax ) of the coherent processing windows of
+ * all valid targets. The window is empty (kmin >= kmax) if there are no valid
+ * targets.
+ */
+inline void getPulseWindow(int* kmin, int* kmax,
+                           const TargetGeometry* targets,
+                           const char* valid, int n)
+{
+    *kmin = std::numeric_limits<int>::max();
+    *kmax = std::numeric_limits<int>::min();
+    for (int idx = 0; idx < n; ++idx) {
+        if (valid[idx]) {
+            *kmin = std::min(*kmin, targets[idx].kstart);
+            *kmax = std::max(*kmax, targets[idx].kstop);
+        }
+    }
+}
+
+/**
+ * Integrate pulses for each valid target in a tile, streaming the tile's
+ * pulse window in blocks of \p pulse_block pulses so that each block of
+ * range-compressed data is reused by every target in the tile while it is
+ * still in cache.
+ *
+ * \p data points to the range-compressed data of pulse \p k0 and must contain
+ * all pulses within the tile's pulse window.
+ */
+inline void integrateTile(std::complex<double>* sum,
+                          const TargetGeometry* targets,
+                          const char* valid,
+                          int n,
+                          const std::complex<float>* data, int k0,
+                          int pulse_block,
+                          const Linspace<double>& sampling_window,
+                          const std::vector<Vec3>& pos,
+                          const std::vector<Vec3>& vel,
+                          double fc,
+                          const Kernel<float>& kernel)
+{
+    int kmin, kmax;
+    getPulseWindow(&kmin, &kmax, targets, valid, n);
+
+    std::fill(sum, sum + n, std::complex<double>(0., 0.));
+    for (int kb = kmin; kb < kmax; kb += pulse_block) {
+        const int kb_stop = std::min(kb + pulse_block, kmax);
+
+        for (int idx = 0; idx < n; ++idx) {
+            if (not valid[idx]) {
+                continue;
+            }
+            const auto& target = targets[idx];
+            const int kstart = std::max(target.kstart, kb);
+            const int kstop = std::min(target.kstop, kb_stop);
+            accumulateCoherent(&sum[idx], data, k0, sampling_window, pos, vel,
+                               target.x, fc, target.tau_atm, kernel, kstart,
+                               kstop);
+        }
+    }
+}
+
+/** Copy integrated tile to output grid, filling invalid targets with NaN */
+inline void writeTile(std::complex<float>* out, int out_samples,
+                      const Tile& tile,
+                      const std::complex<double>* sum,
+                      const char* valid)
+{
+    static constexpr auto nan = std::numeric_limits<float>::quiet_NaN();
+
+    for (int jj = 0; jj < tile.lines; ++jj) {
+        for (int ii = 0; ii < tile.samples; ++ii) {
+            const int idx = jj * tile.samples + ii;
+            const size_t k = size_t(tile.j0 + jj) * out_samples + (tile.i0 + ii);
+            out[k] = valid[idx] ? std::complex<float>(sum[idx])
+                                : std::complex<float>(nan, nan);
+        }
+    }
+}
+
+inline void checkTileParams(const TileParams& tile_params)
+{
+    if (tile_params.azimuth_tile < 1 or tile_params.range_tile < 1 or
+        tile_params.pulse_block < 1) {
+        std::string errmsg = "tile dimensions and pulse block size must be > 0";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), errmsg);
+    }
+}
+
+void backproject(std::complex<float>* out,
+                 const RadarGeometry& out_geometry,
+                 const std::complex<float>* in,
+                 const RadarGeometry& in_geometry,
+                 const DEMInterpolator& dem,
+                 double fc,
+                 double ds,
+                 const Kernel<float>& kernel,
+                 DryTroposphereModel dry_tropo_model,
+                 const Rdr2GeoParams& r2g_params,
+                 const Geo2RdrParams& g2r_params)
+{
+    static constexpr double c = isce3::core::speed_of_light;
+    static constexpr auto nan = std::numeric_limits<float>::quiet_NaN();
+
+    checkBackprojectInputs(out_geometry, in_geometry, dry_tropo_model);
 
     // get input & output radar grid azimuth time & slant range
     Linspace<double> in_azimuth_time = in_geometry.sensingTime();
@@ -124,81 +425,347 @@ void backproject(std::complex<float>* out,
     for (int j = 0; j < out_azimuth_time.size(); ++j) {
         for (int i = 0; i < out_slant_range.size(); ++i) {
 
-            // run rdr2geo using orbit and Doppler associated with output grid
-            // to get target position - must specify initial guess for target
-            // height
+            // must specify initial guesses for target height & azimuth time
             Vec3 llh;
             llh[2] = 0.;
-            {
-                double t = out_azimuth_time[j];
-                double r = out_slant_range[i];
-                double fD = out_geometry.doppler().eval(t, r);
-
-                auto converged = rdr2geo(
-                        t, r, fD, out_geometry.orbit(), ellipsoid, dem, llh,
-                        wvl, out_geometry.lookSide(), r2g_params.threshold,
-                        r2g_params.maxiter, r2g_params.extraiter);
-
-                if (not converged) {
-                    all_converged = false;
-                    out[j * out_geometry.gridWidth() + i] = {nan, nan};
-                    continue;
-                }
+            double t = in_geometry.radarGrid().sensingMid();
+
+            TargetGeometry target;
+            auto converged = estimateTargetGeometry(
+                    &target, &llh, &t, out_azimuth_time[j], out_slant_range[i],
+                    out_geometry, in_geometry, dem, ellipsoid, wvl, ds,
+                    dry_tropo_model, r2g_params, g2r_params);
+
+            if (not converged) {
+                all_converged = false;
+                out[j * out_geometry.gridWidth() + i] = {nan, nan};
+                continue;
             }
 
-            // run geo2rdr using input data's orbit and azimuth carrier to
-            // estimate the center of the coherent processing window for the
-            // target - must specify an initial guess for target azimuth time
-            double t, r;
-            t = in_geometry.radarGrid().sensingMid();
-            {
-                auto converged =
-                        geo2rdr(llh, ellipsoid, in_geometry.orbit(),
-                                in_geometry.doppler(), t, r, wvl,
-                                in_geometry.lookSide(), g2r_params.threshold,
-                                g2r_params.maxiter, g2r_params.delta_range);
-
-                if (not converged) {
-                    all_converged = false;
-                    out[j * out_geometry.gridWidth() + i] = {nan, nan};
-                    continue;
-                }
-            }
+            // integrate pulses
+            out[j * out_geometry.gridWidth() + i] = sumCoherent(
+                    in, sampling_window, pos, vel, target.x, fc,
+                    target.tau_atm, kernel, target.kstart, target.kstop);
+        }
+    }
+
+    if (not all_converged) {
+        std::string errmsg = "rdr2geo/geo2rdr failed to converge for one or "
+                             "more targets";
+        throw isce3::except::RuntimeError(ISCE_SRCINFO(), errmsg);
+    }
+}
+
+void backproject(std::complex<float>* out,
+                 const RadarGeometry& out_geometry,
+                 const std::complex<float>* in,
+                 const RadarGeometry& in_geometry,
+                 const DEMInterpolator& dem,
+                 double fc,
+                 double ds,
+                 const Kernel<float>& kernel,
+                 DryTroposphereModel dry_tropo_model,
+                 const Rdr2GeoParams& r2g_params,
+                 const Geo2RdrParams& g2r_params,
+                 const TileParams& tile_params)
+{
+    static constexpr double c = isce3::core::speed_of_light;
+
+    checkBackprojectInputs(out_geometry, in_geometry, dry_tropo_model);
+    checkTileParams(tile_params);
+
+    // get input & output radar grid azimuth time & slant range
+    Linspace<double> in_azimuth_time = in_geometry.sensingTime();
+    Linspace<double> in_slant_range = in_geometry.slantRange();
+
+    // interpolate platform position & velocity at each pulse
+    std::vector<Vec3> pos(in_azimuth_time.size());
+    std::vector<Vec3> vel(in_azimuth_time.size());
+    for (int i = 0; i < in_azimuth_time.size(); ++i) {
+        double t = in_azimuth_time[i];
+        in_geometry.orbit().interpolate(&pos[i], &vel[i], t);
+    }
+
+    // range sampling window
+    double swst = 2. * in_slant_range.first() / c;
+    double dtau = 2. * in_slant_range.spacing() / c;
+    int nr = in_slant_range.size();
+    Linspace<double> sampling_window(swst, dtau, nr);
+
+    // reference ellipsoid
+    int epsg = dem.epsgCode();
+    Ellipsoid ellipsoid = makeProjection(epsg)->ellipsoid();
+
+    // carrier wavelength
+    double wvl = c / fc;
+
+    // partition output grid into tiles
+    const int out_lines = out_geometry.gridLength();
+    const int out_samples = out_geometry.gridWidth();
+    const int az_tile = tile_params.azimuth_tile;
+    const int rg_tile = tile_params.range_tile;
+    const int az_tiles = (out_lines + az_tile - 1) / az_tile;
+    const int rg_tiles = (out_samples + rg_tile - 1) / rg_tile;
+
+    // loop over output tiles in azimuth-major order so that tiles processed
+    // concurrently by different threads share the same pulses
+    bool all_converged = true;
+#pragma omp parallel for schedule(dynamic)
+    for (int t = 0; t < az_tiles * rg_tiles; ++t) {
+
+        const int j0 = (t / rg_tiles) * az_tile;
+        const int i0 = (t % rg_tiles) * rg_tile;
+        const Tile tile {j0, i0, std::min(az_tile, out_lines - j0),
+                         std::min(rg_tile, out_samples - i0)};
+
+        std::vector<TargetGeometry> targets(tile.size());
+        std::vector<char> valid(tile.size());
+        auto converged = estimateTileGeometry(
+                targets.data(), valid.data(), tile, out_geometry, in_geometry,
+                dem, ellipsoid, wvl, ds, dry_tropo_model, r2g_params,
+                g2r_params);
+
+        if (not converged) {
+            all_converged = false;
+        }
+
+        std::vector<std::complex<double>> sum(tile.size());
+        integrateTile(sum.data(), targets.data(), valid.data(), tile.size(),
+                      in, 0, tile_params.pulse_block, sampling_window, pos,
+                      vel, fc, kernel);
+
+        writeTile(out, out_samples, tile, sum.data(), valid.data());
+    }
+
+    if (not all_converged) {
+        std::string errmsg = "rdr2geo/geo2rdr failed to converge for one or "
+                             "more targets";
+        throw isce3::except::RuntimeError(ISCE_SRCINFO(), errmsg);
+    }
+}
+
+/**
+ * Sliding window of range-compressed pulses read from a raster
+ *
+ * Holds pulses [ start() , stop() ) contiguously in memory.
+ */
+class PulseWindow {
+public:
+    PulseWindow(isce3::io::Raster& raster) : _raster(raster) {}
+
+    int start() const { return _start; }
+    int stop() const { return _stop; }
+    const std::complex<float>* data() const { return _data.data(); }
+
+    /**
+     * Read pulses [ \p kstart , \p kstop ) from the raster into \p buf,
+     * resizing it as needed
+     */
+    void read(std::vector<std::complex<float>>* buf, int kstart,
+              int kstop) const
+    {
+        const size_t nr = _raster.width();
+        const int n = std::max(kstop - kstart, 0);
+        buf->resize(n * nr);
+        if (n > 0) {
+            _raster.getBlock(buf->data(), 0, kstart, nr, n);
+        }
+    }
+
+    /**
+     * Get the first pulse that must be read in order to update the window to
+     * [ \p kstart , \p kstop ), reusing already loaded pulses if possible
+     */
+    int pending(int kstart, int kstop) const
+    {
+        if (kstart < _start or kstart >= _stop) {
+            return kstart;
+        }
+        return std::min(_stop, kstop);
+    }
+
+    /**
+     * Update window to [ \p kstart , \p kstop ) given pulses
+     * [ \p kread , \p kstop ) in \p buf, where \p kread is the first pulse
+     * returned by pending()
+     */
+    void update(int kstart, int kstop, int kread,
+                std::vector<std::complex<float>>* buf)
+    {
+        const size_t nr = _raster.width();
+
+        // no overlap with previously loaded pulses
+        if (kread == kstart) {
+            _data.swap(*buf);
+            _start = kstart;
+            _stop = kstop;
+            return;
+        }
 
-            // convert target LLH to ECEF coordinates
-            Vec3 x = ellipsoid.lonLatToXyz(llh);
-
-            // get platform position and velocity at center of CPI
-            Vec3 p, v;
-            in_geometry.orbit().interpolate(&p, &v, t);
-
-            // estimate synthetic aperture length required to achieve the
-            // desired azimuth resolution
-            double l = wvl * r * (p.norm() / x.norm()) / (2. * ds);
-
-            // approximate CPI duration (assuming constant platform velocity)
-            double cpi = l / v.norm();
-
-            // get coherent integration bounds (pulse indices)
-            double tstart = t - 0.5 * cpi;
-            double tstop = t + 0.5 * cpi;
-            double t0 = in_azimuth_time.first();
-            double dt = in_azimuth_time.spacing();
-            auto kstart = static_cast<int>(std::floor((tstart - t0) / dt));
-            auto kstop = static_cast<int>(std::ceil((tstop - t0) / dt));
-            kstart = std::max(kstart, 0);
-            kstop = std::min(kstop, in_azimuth_time.size());
-
-            // estimate dry troposphere delay
-            double tau_atm = 0.;
-            if (dry_tropo_model == DryTroposphereModel::TSX) {
-                tau_atm = dryTropoDelayTSX(p, llh, ellipsoid);
+        // discard pulses preceding the new window & append new pulses
+        const int keep = std::min(_stop, kstop) - kstart;
+        std::copy(_data.begin() + (kstart - _start) * nr,
+                  _data.begin() + (kstart - _start + keep) * nr,
+                  _data.begin());
+        _data.resize(keep * nr);
+        _data.insert(_data.end(), buf->begin(), buf->end());
+        _start = kstart;
+        _stop = kstop;
+    }
+
+private:
+    isce3::io::Raster& _raster;
+    std::vector<std::complex<float>> _data;
+    int _start = 0;
+    int _stop = 0;
+};
+
+void backproject(std::complex<float>* out,
+                 const RadarGeometry& out_geometry,
+                 isce3::io::Raster& in,
+                 const RadarGeometry& in_geometry,
+                 const DEMInterpolator& dem,
+                 double fc,
+                 double ds,
+                 const Kernel<float>& kernel,
+                 DryTroposphereModel dry_tropo_model,
+                 const Rdr2GeoParams& r2g_params,
+                 const Geo2RdrParams& g2r_params,
+                 const TileParams& tile_params)
+{
+    static constexpr double c = isce3::core::speed_of_light;
+
+    checkBackprojectInputs(out_geometry, in_geometry, dry_tropo_model);
+    checkTileParams(tile_params);
+
+    if (in.length() != size_t(in_geometry.gridLength()) or
+        in.width() != size_t(in_geometry.gridWidth())) {
+        std::string errmsg = "input signal data shape must match input radar "
+                             "grid shape";
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), errmsg);
+    }
+
+    // get input radar grid azimuth time & slant range
+    Linspace<double> in_azimuth_time = in_geometry.sensingTime();
+    Linspace<double> in_slant_range = in_geometry.slantRange();
+
+    // interpolate platform position & velocity at each pulse
+    std::vector<Vec3> pos(in_azimuth_time.size());
+    std::vector<Vec3> vel(in_azimuth_time.size());
+    for (int i = 0; i < in_azimuth_time.size(); ++i) {
+        double t = in_azimuth_time[i];
+        in_geometry.orbit().interpolate(&pos[i], &vel[i], t);
+    }
+
+    // range sampling window
+    double swst = 2. * in_slant_range.first() / c;
+    double dtau = 2. * in_slant_range.spacing() / c;
+    int nr = in_slant_range.size();
+    Linspace<double> sampling_window(swst, dtau, nr);
+
+    // reference ellipsoid
+    int epsg = dem.epsgCode();
+    Ellipsoid ellipsoid = makeProjection(epsg)->ellipsoid();
+
+    // carrier wavelength
+    double wvl = c / fc;
+
+    // output grid is processed in blocks of azimuth_tile lines spanning the
+    // full swath, each partitioned into range tiles
+    const int out_lines = out_geometry.gridLength();
+    const int out_samples = out_geometry.gridWidth();
+    const int az_tile = tile_params.azimuth_tile;
+    const int rg_tile = tile_params.range_tile;
+    const int az_blocks = (out_lines + az_tile - 1) / az_tile;
+    const int rg_tiles = (out_samples + rg_tile - 1) / rg_tile;
+
+    // per-block target geometry, double-buffered so that the next block's
+    // geometry is available when reading ahead
+    struct BlockGeometry {
+        std::vector<TargetGeometry> targets;
+        std::vector<char> valid;
+        int kstart = 0;
+        int kstop = 0;
+    };
+
+    bool all_converged = true;
+
+    auto estimateBlockGeometry = [&](BlockGeometry* block, int b) {
+        const int j0 = b * az_tile;
+        const int lines = std::min(az_tile, out_lines - j0);
+        block->targets.resize(size_t(lines) * out_samples);
+        block->valid.resize(size_t(lines) * out_samples);
+
+        // targets are stored contiguously tile by tile
+#pragma omp parallel for schedule(dynamic)
+        for (int t = 0; t < rg_tiles; ++t) {
+            const int i0 = t * rg_tile;
+            const Tile tile {j0, i0, lines, std::min(rg_tile, out_samples - i0)};
+            const size_t offset = size_t(lines) * i0;
+
+            auto converged = estimateTileGeometry(
+                    &block->targets[offset], &block->valid[offset], tile,
+                    out_geometry, in_geometry, dem, ellipsoid, wvl, ds,
+                    dry_tropo_model, r2g_params, g2r_params);
+
+            if (not converged) {
+                all_converged = false;
             }
+        }
 
-            // integrate pulses
-            out[j * out_geometry.gridWidth() + i] =
-                    sumCoherent(in, sampling_window, pos, vel, x, fc, tau_atm,
-                                kernel, kstart, kstop);
+        getPulseWindow(&block->kstart, &block->kstop, block->targets.data(),
+                       block->valid.data(), block->targets.size());
+        block->kstop = std::max(block->kstart, block->kstop);
+    };
+
+    PulseWindow window(in);
+
+    BlockGeometry curr, next;
+    if (az_blocks > 0) {
+        estimateBlockGeometry(&curr, 0);
+        std::vector<std::complex<float>> buf;
+        const int kread = window.pending(curr.kstart, curr.kstop);
+        window.read(&buf, kread, curr.kstop);
+        window.update(curr.kstart, curr.kstop, kread, &buf);
+    }
+
+    for (int b = 0; b < az_blocks; ++b) {
+
+        // estimate geometry of next block & start reading its pulses in the
+        // background while integrating the current block
+        std::vector<std::complex<float>> ahead;
+        std::future<void> read_ahead;
+        int kread = 0;
+        if (b + 1 < az_blocks) {
+            estimateBlockGeometry(&next, b + 1);
+            kread = window.pending(next.kstart, next.kstop);
+            read_ahead = std::async(std::launch::async, [&]() {
+                window.read(&ahead, kread, next.kstop);
+            });
+        }
+
+        const int j0 = b * az_tile;
+        const int lines = std::min(az_tile, out_lines - j0);
+
+#pragma omp parallel for schedule(dynamic)
+        for (int t = 0; t < rg_tiles; ++t) {
+            const int i0 = t * rg_tile;
+            const Tile tile {j0, i0, lines, std::min(rg_tile, out_samples - i0)};
+            const size_t offset = size_t(lines) * i0;
+
+            std::vector<std::complex<double>> sum(tile.size());
+            integrateTile(sum.data(), &curr.targets[offset],
+                          &curr.valid[offset], tile.size(), window.data(),
+                          window.start(), tile_params.pulse_block,
+                          sampling_window, pos, vel, fc, kernel);
+
+            writeTile(out, out_samples, tile, sum.data(), &curr.valid[offset]);
+        }
+
+        if (read_ahead.valid()) {
+            read_ahead.get();
+            window.update(next.kstart, next.kstop, kread, &ahead);
+            std::swap(curr, next);
         }
     }
 
@@ -3,6 +3,7 @@
 #include <isce3/container/forward.h>
 #include <isce3/core/forward.h>
 #include <isce3/geometry/forward.h>
+#include <isce3/io/forward.h>
 
 #include <complex>
 
@@ -23,6 +24,18 @@ struct Geo2RdrParams {
     double delta_range = 10.;
 };
 
+/** Output tiling & pulse blocking configuration for tiled backprojection */
+struct TileParams {
+    /** Number of output azimuth lines per tile */
+    int azimuth_tile = 32;
+
+    /** Number of output range samples per tile */
+    int range_tile = 128;
+
+    /** Number of range-compressed pulses integrated per cache block */
+    int pulse_block = 64;
+};
+
 /**
  * Focus in azimuth via time-domain backprojection
  *
@@ -50,5 +63,82 @@ void backproject(std::complex<float>* out,
                  const Rdr2GeoParams& r2g_params = {},
                  const Geo2RdrParams& g2r_params = {});
 
+/**
+ * Focus in azimuth via time-domain backprojection, processing the output grid
+ * in tiles
+ *
+ * The output grid is partitioned into rectangular tiles which are distributed
+ * among threads in azimuth-major order, so that concurrently processed tiles
+ * integrate overlapping windows of pulses. Within each tile, the target
+ * geometry is computed first, seeding each rdr2geo/geo2rdr solution from the
+ * neighboring target's solution. The tile's pulse window is then streamed in
+ * blocks of \p tile_params.pulse_block pulses, accumulating the contribution of
+ * each block to every target in the tile before moving on to the next block.
+ *
+ * \param[out] out             Output focused signal data
+ * \param[in]  out_geometry    Target output grid, orbit, & doppler to focus to
+ * \param[in]  in              Input range-compressed signal data
+ * \param[in]  in_geometry     Input data grid, orbit, & doppler
+ * \param[in]  dem             DEM
+ * \param[in]  fc              Center frequency (Hz)
+ * \param[in]  ds              Desired azimuth resolution (m)
+ * \param[in]  kernel          1-D interpolation kernel
+ * \param[in]  dry_tropo_model Dry troposphere path delay model
+ * \param[in]  r2g_params      rdr2geo configuration parameters
+ * \param[in]  g2r_params      geo2rdr configuration parameters
+ * \param[in]  tile_params     Output tiling & pulse blocking parameters
+ */
+void backproject(std::complex<float>* out,
+                 const isce3::container::RadarGeometry& out_geometry,
+                 const std::complex<float>* in,
+                 const isce3::container::RadarGeometry& in_geometry,
+                 const isce3::geometry::DEMInterpolator& dem,
+                 double fc,
+                 double ds,
+                 const isce3::core::Kernel<float>& kernel,
+                 DryTroposphereModel dry_tropo_model,
+                 const Rdr2GeoParams& r2g_params,
+                 const Geo2RdrParams& g2r_params,
+                 const TileParams& tile_params);
+
+/**
+ * Focus in azimuth via time-domain backprojection, streaming range-compressed
+ * data from a raster
+ *
+ * Only the pulses required by the current block of output lines are kept in
+ * memory, so the input datatake need not fit in RAM. The output grid is
+ * processed in blocks of \p tile_params.azimuth_tile lines spanning the full
+ * output swath, each partitioned into range tiles as in the in-memory tiled
+ * mode. Pulses needed by the next block are read in the background while the
+ * current block is integrated, and pulses shared by consecutive blocks are
+ * retained rather than re-read.
+ *
+ * \param[out] out             Output focused signal data
+ * \param[in]  out_geometry    Target output grid, orbit, & doppler to focus to
+ * \param[in]  in              Input range-compressed signal data raster
+ *                             (complex64, one line per pulse)
+ * \param[in]  in_geometry     Input data grid, orbit, & doppler
+ * \param[in]  dem             DEM
+ * \param[in]  fc              Center frequency (Hz)
+ * \param[in]  ds              Desired azimuth resolution (m)
+ * \param[in]  kernel          1-D interpolation kernel
+ * \param[in]  dry_tropo_model Dry troposphere path delay model
+ * \param[in]  r2g_params      rdr2geo configuration parameters
+ * \param[in]  g2r_params      geo2rdr configuration parameters
+ * \param[in]  tile_params     Output tiling & pulse blocking parameters
+ */
+void backproject(std::complex<float>* out,
+                 const isce3::container::RadarGeometry& out_geometry,
+                 isce3::io::Raster& in,
+                 const isce3::container::RadarGeometry& in_geometry,
+                 const isce3::geometry::DEMInterpolator& dem,
+                 double fc,
+                 double ds,
+                 const isce3::core::Kernel<float>& kernel,
+                 DryTroposphereModel dry_tropo_model = DryTroposphereModel::TSX,
+                 const Rdr2GeoParams& r2g_params = {},
+                 const Geo2RdrParams& g2r_params = {},
+                 const TileParams& tile_params = {});
+
 } // namespace focus
 } // namespace isce3
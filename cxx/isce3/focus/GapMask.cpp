@@ -45,35 +45,82 @@ GapMask::GapMask(const std::vector<double> & azimuth_time, int samples,
     }
 }
 
-std::vector<std::pair<int, int>>
-GapMask::gaps(int pulse) const
+template<typename F>
+void
+GapMask::forEachGap(int first_pulse, int npulses, F && f) const
 {
-    if ((pulse < 0) || (pulse >= t.size())) {
+    if ((first_pulse < 0) || (npulses < 0) ||
+        (first_pulse + npulses > static_cast<int>(t.size()))) {
         throw isce3::except::DomainError(ISCE_SRCINFO(), "pulse out of bounds");
     }
-    std::vector<std::pair<int, int>> g;
-    const double t0 = t[pulse] + dwp;
-    const double t1 = t0 + n / fs;
-    // Loop over pulses in the air.
-    for (int i = pulse; i < t.size(); ++i) {
+    // Index of first TX event after the end of the RX window.  Transmit
+    // times are monotonic, so it never decreases from one pulse to the next.
+    int end = first_pulse;
+    for (int p = 0; p < npulses; ++p) {
+        const int pulse = first_pulse + p;
+        const double t0 = t[pulse] + dwp;
+        const double t1 = t0 + n / fs;
+        end = std::max(end, pulse);
         // Done when pulses occur after end of RX window.
         // Typically 10-20 pulses for NISAR.
-        if ((t[i] - guard) > t1) {
-            break;
+        while ((end < static_cast<int>(t.size())) && ((t[end] - guard) <= t1)) {
+            ++end;
         }
-        int j0 = static_cast<int>(std::lround((t[i] - t0 - guard) * fs));
-        int j1 = static_cast<int>(std::lround(
-            (t[i] + chirplen + guard - t0) * fs));
-        // TX[i] overlaps RX[pulse]
-        if ((j0 <= n) && (j1 >= 0)) {
-            j0 = std::max(0, j0);
-            j1 = std::min(n, j1);
-            g.push_back(std::make_pair(j0, j1));
+        // Loop over pulses in the air.
+        for (int i = pulse; i < end; ++i) {
+            int j0 = static_cast<int>(std::lround((t[i] - t0 - guard) * fs));
+            int j1 = static_cast<int>(std::lround(
+                (t[i] + chirplen + guard - t0) * fs));
+            // TX[i] overlaps RX[pulse]
+            if ((j0 <= n) && (j1 >= 0)) {
+                f(p, std::max(0, j0), std::min(n, j1));
+            }
         }
     }
+}
+
+std::vector<std::pair<int, int>>
+GapMask::gaps(int pulse) const
+{
+    std::vector<std::pair<int, int>> g;
+    forEachGap(pulse, 1, [&](int, int j0, int j1) {
+        g.push_back(std::make_pair(j0, j1));
+    });
     return g;
 }
 
+void
+GapMask::gaps(std::vector<std::pair<int, int>> & gaps,
+              std::vector<int> & offsets, int first_pulse, int npulses) const
+{
+    gaps.clear();
+    offsets.assign(npulses + 1, 0);
+    forEachGap(first_pulse, npulses, [&](int p, int j0, int j1) {
+        gaps.push_back(std::make_pair(j0, j1));
+        offsets[p + 1] = gaps.size();
+    });
+    // fill in offsets of pulses without any gaps
+    for (int p = 0; p < npulses; ++p) {
+        offsets[p + 1] = std::max(offsets[p + 1], offsets[p]);
+    }
+}
+
+void
+GapMask::apply(std::complex<float> * data, int first_pulse, int npulses,
+               int stride, std::complex<float> fill) const
+{
+    if (stride < 0) {
+        throw isce3::except::DomainError(ISCE_SRCINFO(), "require stride >= 0");
+    }
+    forEachGap(first_pulse, npulses, [&](int p, int j0, int j1) {
+        j1 = std::min(j1, stride);
+        if (j0 < j1) {
+            std::complex<float> * line = &data[std::size_t(p) * stride];
+            std::fill(line + j0, line + j1, fill);
+        }
+    });
+}
+
 std::vector<bool>
 GapMask::mask(int pulse) const
 {
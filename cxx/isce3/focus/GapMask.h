@@ -1,5 +1,6 @@
 #pragma once
 
+#include <complex>
 #include <utility>
 #include <vector>
 
@@ -39,7 +40,44 @@ public:
     std::vector<bool>
     mask(int pulse) const;
 
+    /** Compute gap locations for a block of consecutive pulses.
+     *
+     * Gaps of the whole block are found in a single pass over the transmit
+     * events.  Output containers are cleared and refilled so that their
+     * storage may be reused from one block to the next.
+     *
+     * @param[out] gaps         Concatenated list of [start, stop) range
+     *                          indices blocked by transmit events
+     * @param[out] offsets      Gaps of pulse (first_pulse + i) are elements
+     *                          [offsets[i], offsets[i + 1]) of gaps.
+     *                          Resized to npulses + 1.
+     * @param[in]  first_pulse  Index of first range line in block
+     * @param[in]  npulses      Number of range lines in block
+     */
+    void
+    gaps(std::vector<std::pair<int, int>> & gaps, std::vector<int> & offsets,
+         int first_pulse, int npulses) const;
+
+    /** Blank gaps in a block of consecutive pulses in place.
+     *
+     * @param[in,out] data          Block of npulses range lines
+     * @param[in]     first_pulse   Index of first range line in block
+     * @param[in]     npulses       Number of range lines in block
+     * @param[in]     stride        Number of elements between the start of
+     *                              consecutive range lines.  Gaps are clipped
+     *                              to the stride.
+     * @param[in]     fill          Value assigned to blocked samples
+     */
+    void
+    apply(std::complex<float> * data, int first_pulse, int npulses,
+          int stride, std::complex<float> fill = 0.f) const;
+
 private:
+    /** Call f(i, start, stop) for each gap of pulse (first_pulse + i) */
+    template<typename F>
+    void forEachGap(int first_pulse, int npulses, F && f) const;
+
+
     std::vector<double> t;
     int n;
     double dwp;
@@ -1,10 +1,18 @@
 #include "RangeComp.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
+#include <numeric>
 
 #include <isce3/except/Error.h>
 
+#include "GapMask.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace isce3 { namespace focus {
 
 inline
@@ -19,6 +27,29 @@ int getOutputSize(int m, int n, RangeComp::Mode mode)
     throw isce3::except::RuntimeError(ISCE_SRCINFO(), "unexpected range compression mode");
 }
 
+inline
+int getOutputOffset(int chirpsize, RangeComp::Mode mode)
+{
+    switch (mode) {
+        case RangeComp::Mode::Full  : return 0;
+        case RangeComp::Mode::Valid : return chirpsize - 1;
+        case RangeComp::Mode::Same  : return chirpsize / 2;
+    }
+
+    throw isce3::except::RuntimeError(ISCE_SRCINFO(), "unexpected range compression mode");
+}
+
+static
+int checkChirpSize(const std::vector<std::complex<float>> & chirp)
+{
+    // make sure chirp size can be cast to int
+    std::size_t maxint = std::numeric_limits<int>::max();
+    if (chirp.size() > maxint) {
+        throw isce3::except::OverflowError(ISCE_SRCINFO(), "chirp length exceeds max int");
+    }
+    return static_cast<int>(chirp.size());
+}
+
 static
 std::vector<std::complex<float>>
 formRangeReference(const std::vector<std::complex<float>> & chirp, int fftsize)
@@ -36,20 +67,99 @@ formRangeReference(const std::vector<std::complex<float>> & chirp, int fftsize)
     return reffn;
 }
 
+/**
+ * Get the smallest FFT-friendly length >= n that is a multiple of m, where m
+ * has no prime factors other than 2, 3 & 5
+ */
+static
+int nextFastMultiple(int n, int m)
+{
+    int k = fft::nextFastPower(n);
+    while (k % m != 0) {
+        k = fft::nextFastPower(k + 1);
+    }
+    return k;
+}
+
+/**
+ * Form the matched filter spectrum cropped to the band of the decimated
+ * output, with the output mode's time offset folded in as a linear phase
+ * ramp and scaled by the inverse FFT normalization.
+ */
+static
+std::vector<std::complex<float>>
+formDecimatedReference(const std::vector<std::complex<float>> & reffn,
+                       int dfftsize, int offset, float scale)
+{
+    const int fftsize = reffn.size();
+    std::vector<std::complex<float>> dreffn(dfftsize);
+    for (int i = 0; i < dfftsize; ++i) {
+        // signed frequency bin
+        const int k = (i < (dfftsize + 1) / 2) ? i : i - dfftsize;
+        const double phi = 2. * M_PI * k * offset / fftsize;
+        const std::complex<double> ramp(std::cos(phi), std::sin(phi));
+        const int j = (k < 0) ? k + fftsize : k;
+        dreffn[i] = std::complex<float>(std::complex<double>(reffn[j]) * ramp) * scale;
+    }
+    return dreffn;
+}
+
+/**
+ * Multiply the bins of a full-rate spectrum that fall in the band of the
+ * decimated output by the decimated matched filter. The spectrum of
+ * real-valued offset-video input holds the non-negative frequency bins only,
+ * with baseband at fs/4.
+ */
+static
+void cropSpectrum(std::complex<float> * dest, const std::complex<float> * src,
+                  const std::complex<float> * dreffn, int fftsize,
+                  int dfftsize, bool real_input)
+{
+    // spectrum bin corresponding to baseband (fs/4 for offset-video input)
+    const int shift = real_input ? fftsize / 4 : 0;
+    const int nyquist = fftsize / 2;
+
+    for (int i = 0; i < dfftsize; ++i) {
+        // signed frequency bin of the decimated output
+        const int k = (i < (dfftsize + 1) / 2) ? i : i - dfftsize;
+
+        // corresponding bin of the full-rate input spectrum
+        int j = k + shift;
+        if (real_input) {
+            // only non-negative frequencies are available (and needed)
+            if (j < 0 or j > nyquist) {
+                dest[i] = 0.f;
+                continue;
+            }
+            // DC & Nyquist bins have no negative-frequency counterpart
+            if (j == 0 or j == nyquist) {
+                dest[i] = 0.5f * src[j] * dreffn[i];
+                continue;
+            }
+        } else if (j < 0) {
+            j += fftsize;
+        }
+
+        dest[i] = src[j] * dreffn[i];
+    }
+}
+
 RangeComp::RangeComp(const std::vector<std::complex<float>> & chirp,
                      int inputsize,
                      int maxbatch,
                      Mode mode)
 :
-    _chirpsize([=]()
-        {
-            // make sure chirp size can be cast to int
-            std::size_t maxint = std::numeric_limits<int>::max();
-            if (chirp.size() > maxint) {
-                throw isce3::except::OverflowError(ISCE_SRCINFO(), "chirp length exceeds max int");
-            }
-            return static_cast<int>(chirp.size());
-        }()),
+    RangeComp(chirp, inputsize, maxbatch, mode, 1, false)
+{}
+
+RangeComp::RangeComp(const std::vector<std::complex<float>> & chirp,
+                     int inputsize,
+                     int maxbatch,
+                     Mode mode,
+                     int decimation,
+                     bool real_input)
+:
+    _chirpsize(checkChirpSize(chirp)),
     _inputsize([=]()
         {
             if (inputsize < 1) {
@@ -57,7 +167,23 @@ RangeComp::RangeComp(const std::vector<std::complex<float>> & chirp,
             }
             return inputsize;
         }()),
-    _fftsize(fft::nextFastPower(getOutputSize(_chirpsize, inputsize, Mode::Full))),
+    _decimation([=]()
+        {
+            if (decimation < 1) {
+                throw isce3::except::DomainError(ISCE_SRCINFO(), "decimation factor must be > 0");
+            }
+            return decimation;
+        }()),
+    _realinput(real_input),
+    _dfftsize([=]()
+        {
+            // shifting an fs/4 offset-video spectrum to baseband by a whole
+            // number of bins requires the full-rate FFT length to be a
+            // multiple of 4
+            int n = getOutputSize(_chirpsize, inputsize, Mode::Full);
+            int m = real_input ? 4 / std::gcd(4, decimation) : 1;
+            return nextFastMultiple((n + decimation - 1) / decimation, m);
+        }()),
     _maxbatch([=]()
         {
             if (maxbatch < 1) {
@@ -65,27 +191,53 @@ RangeComp::RangeComp(const std::vector<std::complex<float>> & chirp,
             }
             return maxbatch;
         }()),
-    _mode(mode),
-    _reffn(formRangeReference(chirp, _fftsize)),
-    _wkspc(std::size_t(maxbatch) * _fftsize),
-    _fftplan(fft::planfft1d(_wkspc.data(), _wkspc.data(), {maxbatch, _fftsize}, 1)),
-    _ifftplan(fft::planifft1d(_wkspc.data(), _wkspc.data(), {maxbatch, _fftsize}, 1))
-{}
+    _mode(mode)
+{
+    _fftsize = _dfftsize * _decimation;
+    _reffn = formRangeReference(chirp, _fftsize);
+    _wkspc.resize(std::size_t(_maxbatch) * _fftsize);
+
+    // plain full-rate complex convolution
+    if (not _realinput and _decimation == 1) {
+        _fftplan = fft::planfft1d(_wkspc.data(), _wkspc.data(), {_maxbatch, _fftsize}, 1);
+        _ifftplan = fft::planifft1d(_wkspc.data(), _wkspc.data(), {_maxbatch, _fftsize}, 1);
+        return;
+    }
+
+    // forward transform of the full-rate input, inverse transform of the
+    // spectrum cropped to the decimated band
+    if (_realinput) {
+        _rwkspc.resize(std::size_t(_maxbatch) * _fftsize);
+        _fftplan = fft::planfft1d(_wkspc.data(), _rwkspc.data(), {_maxbatch, _fftsize}, 1);
+    } else {
+        _fftplan = fft::planfft1d(_wkspc.data(), _wkspc.data(), {_maxbatch, _fftsize}, 1);
+    }
+    _dwkspc.resize(std::size_t(_maxbatch) * _dfftsize);
+    _difftplan = fft::planifft1d(_dwkspc.data(), _dwkspc.data(), {_maxbatch, _dfftsize}, 1);
+
+    // the analytic signal of real-valued input has twice the amplitude of
+    // its positive-frequency half-spectrum
+    float scale = (_realinput ? 2.f : 1.f) / _fftsize;
+    int offset = getOutputOffset(_chirpsize, _mode);
+    _dreffn = formDecimatedReference(_reffn, _dfftsize, offset, scale);
+}
 
 int RangeComp::outputSize() const
 {
-    return getOutputSize(chirpSize(), inputSize(), mode());
+    int n = getOutputSize(chirpSize(), inputSize(), mode());
+    return (n + decimation() - 1) / decimation();
 }
 
 int RangeComp::firstValidSample() const
 {
+    int first = 0;
     switch (mode()) {
-        case Mode::Full  : return chirpSize() - 1;
-        case Mode::Valid : return 0;
-        case Mode::Same  : return chirpSize() / 2;
+        case Mode::Full  : first = chirpSize() - 1; break;
+        case Mode::Valid : first = 0; break;
+        case Mode::Same  : first = chirpSize() / 2; break;
     }
 
-    throw isce3::except::RuntimeError(ISCE_SRCINFO(), "unexpected range compression mode");
+    return (first + decimation() - 1) / decimation();
 }
 
 void RangeComp::rangecompress(std::complex<float> * out,
@@ -95,6 +247,9 @@ void RangeComp::rangecompress(std::complex<float> * out,
     if (batch > maxBatch()) {
         throw isce3::except::LengthError(ISCE_SRCINFO(), "batch size exceeds max batch");
     }
+    if (realInput()) {
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), "range compressor expects real-valued input");
+    }
 
     // copy input data to internal workspace buffer & zero pad to FFT length
     int padding = fftSize() - inputSize();
@@ -106,6 +261,12 @@ void RangeComp::rangecompress(std::complex<float> * out,
         std::fill_n(dest + inputSize(), padding, std::complex<float>(0.f));
     }
 
+    if (decimation() > 1) {
+        _fftplan.execute();
+        decimatedConvolve(out, batch);
+        return;
+    }
+
     // FFT convolve
     float scale = 1. / fftSize();
     _fftplan.execute();
@@ -118,9 +279,7 @@ void RangeComp::rangecompress(std::complex<float> * out,
     _ifftplan.execute();
 
     // crop to output range & copy result to output buffer
-    int offset = (mode() == Mode::Full) ? 0 :
-                 (mode() == Mode::Valid) ? chirpSize() - 1 :
-                 chirpSize() / 2;
+    int offset = getOutputOffset(chirpSize(), mode());
     #pragma omp parallel for
     for (int b = 0; b < batch; ++b) {
         const std::complex<float> * src = &_wkspc[std::size_t(b) * fftSize()];
@@ -129,4 +288,230 @@ void RangeComp::rangecompress(std::complex<float> * out,
     }
 }
 
+void RangeComp::rangecompress(std::complex<float> * out,
+                              const float * in,
+                              int batch)
+{
+    if (batch > maxBatch()) {
+        throw isce3::except::LengthError(ISCE_SRCINFO(), "batch size exceeds max batch");
+    }
+    if (not realInput()) {
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(), "range compressor expects complex input");
+    }
+
+    // copy input data to internal workspace buffer & zero pad to FFT length
+    int padding = fftSize() - inputSize();
+    #pragma omp parallel for
+    for (int b = 0; b < batch; ++b) {
+        const float * src = &in[std::size_t(b) * inputSize()];
+        float * dest = &_rwkspc[std::size_t(b) * fftSize()];
+        std::copy(src, src + inputSize(), dest);
+        std::fill_n(dest + inputSize(), padding, 0.f);
+    }
+
+    // real-to-complex transform yields the non-negative frequency bins
+    _fftplan.execute();
+    decimatedConvolve(out, batch);
+}
+
+void RangeComp::decimatedConvolve(std::complex<float> * out, int batch)
+{
+    #pragma omp parallel for
+    for (int b = 0; b < batch; ++b) {
+        cropSpectrum(&_dwkspc[std::size_t(b) * _dfftsize],
+                     &_wkspc[std::size_t(b) * fftSize()], _dreffn.data(),
+                     fftSize(), _dfftsize, realInput());
+    }
+
+    _difftplan.execute();
+
+    // crop to output size (mode offset is already applied)
+    #pragma omp parallel for
+    for (int b = 0; b < batch; ++b) {
+        const std::complex<float> * src = &_dwkspc[std::size_t(b) * _dfftsize];
+        std::complex<float> * dest = &out[std::size_t(b) * outputSize()];
+        std::copy_n(src, outputSize(), dest);
+    }
+}
+
+ParallelRangeComp::ParallelRangeComp(const std::vector<std::complex<float>> & chirp,
+                                     int inputsize,
+                                     int batch,
+                                     Mode mode,
+                                     int decimation,
+                                     int threads)
+:
+    _chirpsize(checkChirpSize(chirp)),
+    _inputsize([=]()
+        {
+            if (inputsize < 1) {
+                throw isce3::except::DomainError(ISCE_SRCINFO(), "number of samples must be > 0");
+            }
+            return inputsize;
+        }()),
+    _batch([=]()
+        {
+            if (batch < 1) {
+                throw isce3::except::DomainError(ISCE_SRCINFO(), "batch size must be > 0");
+            }
+            return batch;
+        }()),
+    _mode(mode),
+    _decimation([=]()
+        {
+            if (decimation < 1) {
+                throw isce3::except::DomainError(ISCE_SRCINFO(), "decimation factor must be > 0");
+            }
+            return decimation;
+        }()),
+    _dfftsize([=]()
+        {
+            int n = getOutputSize(_chirpsize, inputsize, Mode::Full);
+            return fft::nextFastPower((n + _decimation - 1) / _decimation);
+        }()),
+    _fftsize(_dfftsize * _decimation),
+    _reffn(formRangeReference(chirp, _fftsize))
+{
+    if (threads < 1) {
+        threads = fft::detail::getMaxThreads();
+    }
+
+    // the decimated output is the inverse transform of the spectrum cropped
+    // to its band (see RangeComp)
+    if (_decimation > 1) {
+        int offset = getOutputOffset(_chirpsize, _mode);
+        _dreffn = formDecimatedReference(_reffn, _dfftsize, offset, 1.f / _fftsize);
+    }
+
+    // FFTW plan creation is not thread-safe, so create all per-thread plans
+    // up front
+    _workspaces.resize(threads);
+    for (auto & ws : _workspaces) {
+        ws.data.resize(std::size_t(_batch) * _fftsize);
+        ws.fftplan = fft::FwdFFTPlan<float>(ws.data.data(), ws.data.data(),
+                _fftsize, _batch, FFTW_MEASURE, 1);
+        if (_decimation > 1) {
+            ws.ddata.resize(std::size_t(_batch) * _dfftsize);
+            ws.ifftplan = fft::InvFFTPlan<float>(ws.ddata.data(), ws.ddata.data(),
+                    _dfftsize, _batch, FFTW_MEASURE, 1);
+        } else {
+            ws.ifftplan = fft::InvFFTPlan<float>(ws.data.data(), ws.data.data(),
+                    _fftsize, _batch, FFTW_MEASURE, 1);
+        }
+    }
+}
+
+int ParallelRangeComp::outputSize() const
+{
+    int n = getOutputSize(chirpSize(), inputSize(), mode());
+    return (n + decimation() - 1) / decimation();
+}
+
+int ParallelRangeComp::firstValidSample() const
+{
+    int first = (mode() == Mode::Full) ? chirpSize() - 1 :
+                (mode() == Mode::Valid) ? 0 :
+                chirpSize() / 2;
+    return (first + decimation() - 1) / decimation();
+}
+
+void ParallelRangeComp::rangecompress(std::complex<float> * out,
+                                      const std::complex<float> * in,
+                                      int npulses)
+{
+    rangecompress(out, in, npulses, nullptr, 0);
+}
+
+void ParallelRangeComp::rangecompress(std::complex<float> * out,
+                                      const std::complex<float> * in,
+                                      int npulses,
+                                      const GapMask & gapmask,
+                                      int first_pulse)
+{
+    rangecompress(out, in, npulses, &gapmask, first_pulse);
+}
+
+void ParallelRangeComp::rangecompress(std::complex<float> * out,
+                                      const std::complex<float> * in,
+                                      int npulses,
+                                      const GapMask * gapmask,
+                                      int first_pulse)
+{
+    if (npulses < 0) {
+        throw isce3::except::DomainError(ISCE_SRCINFO(), "number of pulses must be >= 0");
+    }
+
+    const int nbatches = (npulses + batchSize() - 1) / batchSize();
+    const int offset = getOutputOffset(chirpSize(), mode());
+    const int outsize = outputSize();
+    const float scale = 1. / fftSize();
+
+    #pragma omp parallel for schedule(dynamic) num_threads(threads())
+    for (int ib = 0; ib < nbatches; ++ib) {
+#ifdef _OPENMP
+        Workspace & ws = _workspaces[omp_get_thread_num()];
+#else
+        Workspace & ws = _workspaces[0];
+#endif
+        const int p0 = ib * batchSize();
+        const int batch = std::min(batchSize(), npulses - p0);
+
+        // copy input data to workspace & zero pad to FFT length
+        for (int b = 0; b < batch; ++b) {
+            const std::complex<float> * src = &in[std::size_t(p0 + b) * inputSize()];
+            std::complex<float> * dest = &ws.data[std::size_t(b) * fftSize()];
+            std::copy(src, src + inputSize(), dest);
+            std::fill(dest + inputSize(), dest + fftSize(), std::complex<float>(0.f));
+        }
+
+        // blank gaps (any that extend past the input land in the padding)
+        if (gapmask) {
+            gapmask->apply(ws.data.data(), first_pulse + p0, batch, fftSize());
+        }
+
+        // zero unused rows of a partial batch, which are transformed but
+        // discarded
+        std::fill(ws.data.begin() + std::size_t(batch) * fftSize(),
+                  ws.data.end(), std::complex<float>(0.f));
+
+        ws.fftplan.execute();
+
+        if (decimation() > 1) {
+            // convolve with the matched filter cropped to the decimated band
+            // (the mode offset is applied by the filter)
+            for (int b = 0; b < batch; ++b) {
+                cropSpectrum(&ws.ddata[std::size_t(b) * _dfftsize],
+                             &ws.data[std::size_t(b) * fftSize()],
+                             _dreffn.data(), fftSize(), _dfftsize, false);
+            }
+            std::fill(ws.ddata.begin() + std::size_t(batch) * _dfftsize,
+                      ws.ddata.end(), std::complex<float>(0.f));
+            ws.ifftplan.execute();
+
+            for (int b = 0; b < batch; ++b) {
+                const std::complex<float> * src = &ws.ddata[std::size_t(b) * _dfftsize];
+                std::complex<float> * dest = &out[std::size_t(p0 + b) * outsize];
+                std::copy_n(src, outsize, dest);
+            }
+            continue;
+        }
+
+        // FFT convolve
+        for (int b = 0; b < batch; ++b) {
+            std::complex<float> * z = &ws.data[std::size_t(b) * fftSize()];
+            for (int i = 0; i < fftSize(); ++i) {
+                z[i] *= _reffn[i] * scale;
+            }
+        }
+        ws.ifftplan.execute();
+
+        // crop to output buffer
+        for (int b = 0; b < batch; ++b) {
+            const std::complex<float> * src = &ws.data[std::size_t(b) * fftSize() + offset];
+            std::complex<float> * dest = &out[std::size_t(p0 + b) * outsize];
+            std::copy_n(src, outsize, dest);
+        }
+    }
+}
+
 }}
@@ -7,6 +7,8 @@
 
 namespace isce3 { namespace focus {
 
+class GapMask;
+
 /** Range compression processor */
 class RangeComp {
 public:
@@ -54,6 +56,37 @@ public:
               int maxbatch = 1,
               Mode mode = Mode::Full);
 
+    /**
+     * Constructor for decimated and/or real-valued input processing
+     *
+     * If \p decimation is greater than one, the product of the input spectrum
+     * and the matched filter is cropped to the band [-fs/(2D), fs/(2D)) about
+     * baseband prior to the inverse FFT, producing an output sampled at fs/D,
+     * where fs is the input sample rate and D the decimation factor.
+     *
+     * If \p real_input is true, the input is expected to be real-valued
+     * offset-video data with the signal spectrum centered at fs/4. Its
+     * positive-frequency half-spectrum is computed via a real-to-complex FFT
+     * and shifted to baseband, yielding complex baseband output. A decimation
+     * factor of 2 retains the full complex bandwidth (fs/2) of the input.
+     *
+     * In either case, the chirp replica must be complex baseband sampled at
+     * the input sample rate.
+     *
+     * \param[in] chirp      Time-domain replica of the transmitted chirp waveform
+     * \param[in] inputsize  Number of range samples in the signal to be compressed
+     * \param[in] maxbatch   Max batch size
+     * \param[in] mode       Convolution output mode
+     * \param[in] decimation Output decimation factor
+     * \param[in] real_input Whether the input is real-valued offset-video data
+     */
+    RangeComp(const std::vector<std::complex<float>> & chirp,
+              int inputsize,
+              int maxbatch,
+              Mode mode,
+              int decimation,
+              bool real_input = false);
+
     /** Number of samples in chirp */
     int chirpSize() const { return _chirpsize; }
 
@@ -69,12 +102,18 @@ public:
     /** Output mode */
     Mode mode() const { return _mode; }
 
-    /** Output number of samples */
+    /** Output decimation factor */
+    int decimation() const { return _decimation; }
+
+    /** Whether the input is real-valued offset-video data */
+    bool realInput() const { return _realinput; }
+
+    /** Output number of samples (after decimation) */
     int outputSize() const;
 
     /**
      * Return the (zero-based) index of the first fully-focused pixel in the
-     * output.
+     * (decimated) output.
      */
     int firstValidSample() const;
 
@@ -85,6 +124,7 @@ public:
      * function.
      *
      * \throws LengthError  If \p batch exceeds the max batch size
+     * \throws InvalidArgument If the processor expects real-valued input
      *
      * \param[out] out      Range-compressed data
      * \param[in]  in       Input data
@@ -92,16 +132,163 @@ public:
      */
     void rangecompress(std::complex<float> * out, const std::complex<float> * in, int batch = 1);
 
+    /**
+     * Perform pulse compression on a batch of real-valued offset-video input
+     * signals
+     *
+     * \throws LengthError  If \p batch exceeds the max batch size
+     * \throws InvalidArgument If the processor expects complex input
+     *
+     * \param[out] out      Range-compressed complex baseband data
+     * \param[in]  in       Input data
+     * \param[in]  batch    Input batch size
+     */
+    void rangecompress(std::complex<float> * out, const float * in, int batch = 1);
+
 private:
+    /**
+     * Multiply the batch spectrum by the matched filter, cropped to the
+     * decimated band, and inverse transform to the output buffer
+     */
+    void decimatedConvolve(std::complex<float> * out, int batch);
+
     int _chirpsize;
     int _inputsize;
+    int _decimation;
+    bool _realinput;
     int _fftsize;
+    int _dfftsize;
     int _maxbatch;
     Mode _mode;
     std::vector<std::complex<float>> _reffn;
+    std::vector<std::complex<float>> _dreffn;
     std::vector<std::complex<float>> _wkspc;
+    std::vector<float> _rwkspc;
+    std::vector<std::complex<float>> _dwkspc;
     isce3::fft::FwdFFTPlan<float> _fftplan;
     isce3::fft::InvFFTPlan<float> _ifftplan;
+    isce3::fft::InvFFTPlan<float> _difftplan;
+};
+
+/**
+ * Multi-threaded range compression processor
+ *
+ * Unlike RangeComp, which compresses a single batch at a time using shared
+ * FFT plans & workspace, each thread owns its own workspace and
+ * single-threaded FFT plans. Whole blocks of pulses are compressed by
+ * distributing batches of pulses among threads. Within each batch, gap
+ * masking, zero padding, the matched filter multiply, cropping and output
+ * decimation are all applied while the batch is resident in the thread's
+ * workspace.
+ */
+class ParallelRangeComp {
+public:
+    /** Convolution output mode */
+    using Mode = RangeComp::Mode;
+
+    /**
+     * Constructor
+     *
+     * \param[in] chirp      Time-domain replica of the transmitted chirp waveform
+     * \param[in] inputsize  Number of range samples in the signal to be compressed
+     * \param[in] batch      Number of pulses processed per thread at a time
+     * \param[in] mode       Convolution output mode
+     * \param[in] decimation Output decimation factor. As with RangeComp, the
+     *                       product of the input spectrum and the matched
+     *                       filter is cropped to the band [-fs/(2D), fs/(2D))
+     *                       about baseband prior to the inverse FFT.
+     * \param[in] threads    Number of threads (defaults to max OpenMP threads)
+     */
+    ParallelRangeComp(const std::vector<std::complex<float>> & chirp,
+                      int inputsize,
+                      int batch = 16,
+                      Mode mode = Mode::Full,
+                      int decimation = 1,
+                      int threads = -1);
+
+    /** Number of samples in chirp */
+    int chirpSize() const { return _chirpsize; }
+
+    /** Expected number of samples in the input signal to be compressed */
+    int inputSize() const { return _inputsize; }
+
+    /** FFT length */
+    int fftSize() const { return _fftsize; }
+
+    /** Number of pulses processed per thread at a time */
+    int batchSize() const { return _batch; }
+
+    /** Output mode */
+    Mode mode() const { return _mode; }
+
+    /** Output decimation factor */
+    int decimation() const { return _decimation; }
+
+    /** Number of threads */
+    int threads() const { return static_cast<int>(_workspaces.size()); }
+
+    /** Output number of samples (after decimation) */
+    int outputSize() const;
+
+    /**
+     * Return the (zero-based) index of the first fully-focused pixel in the
+     * (decimated) output.
+     */
+    int firstValidSample() const;
+
+    /**
+     * Perform pulse compression on a block of input signals
+     *
+     * \param[out] out     Range-compressed data (npulses x outputSize())
+     * \param[in]  in      Input data (npulses x inputSize())
+     * \param[in]  npulses Number of pulses
+     */
+    void rangecompress(std::complex<float> * out,
+                       const std::complex<float> * in,
+                       int npulses);
+
+    /**
+     * Perform pulse compression on a block of input signals, zeroing samples
+     * blocked by transmit events prior to compression
+     *
+     * \param[out] out         Range-compressed data (npulses x outputSize())
+     * \param[in]  in          Input data (npulses x inputSize())
+     * \param[in]  npulses     Number of pulses
+     * \param[in]  gapmask     Gap mask describing transmit events
+     * \param[in]  first_pulse Index of the first pulse of the block w.r.t.
+     *                         the gap mask
+     */
+    void rangecompress(std::complex<float> * out,
+                       const std::complex<float> * in,
+                       int npulses,
+                       const GapMask & gapmask,
+                       int first_pulse);
+
+private:
+    /** Per-thread FFT workspace & plans */
+    struct Workspace {
+        std::vector<std::complex<float>> data;
+        std::vector<std::complex<float>> ddata;
+        isce3::fft::FwdFFTPlan<float> fftplan;
+        isce3::fft::InvFFTPlan<float> ifftplan;
+    };
+
+    void rangecompress(std::complex<float> * out,
+                       const std::complex<float> * in,
+                       int npulses,
+                       const GapMask * gapmask,
+                       int first_pulse);
+
+    int _chirpsize;
+    int _inputsize;
+    int _batch;
+    Mode _mode;
+    int _decimation;
+    int _dfftsize;
+    int _fftsize;
+    std::vector<std::complex<float>> _reffn;
+    std::vector<std::complex<float>> _dreffn;
+    std::vector<Workspace> _workspaces;
 };
 
 }}
@@ -25,3 +25,38 @@ void isce3::geocode::baseband(isce3::core::Matrix<std::complex<float>>& data,
         data(line, col) *= cpx_phase;
     }
 }
+
+void isce3::geocode::baseband(
+        isce3::core::Matrix<std::complex<float>>& data,
+        const isce3::core::Matrix<std::complex<float>>& phasor,
+        const std::vector<int>& first_col, const std::vector<int>& last_col)
+{
+    const int length = data.length();
+#pragma omp parallel for
+    for (int line = 0; line < length; ++line) {
+        for (int col = first_col[line]; col <= last_col[line]; ++col) {
+            data(line, col) *= phasor(line, col);
+        }
+    }
+}
+
+void isce3::geocode::basebandPhasor(
+        isce3::core::Matrix<std::complex<float>>& phasor,
+        const std::vector<int>& first_col, const std::vector<int>& last_col,
+        const double starting_range, const double sensing_start,
+        const double range_pixel_spacing, const double prf,
+        const isce3::core::LUT2d<double>& doppler_lut)
+{
+    const int length = phasor.length();
+#pragma omp parallel for schedule(dynamic)
+    for (int line = 0; line < length; ++line) {
+        const double azimuth_time = sensing_start + line / prf;
+        for (int col = first_col[line]; col <= last_col[line]; ++col) {
+            const double slant_range = starting_range + col * range_pixel_spacing;
+            const double phase = doppler_lut.eval(azimuth_time, slant_range) *
+                                 2 * M_PI * azimuth_time;
+            phasor(line, col) =
+                    std::complex<float>(std::cos(phase), -std::sin(phase));
+        }
+    }
+}
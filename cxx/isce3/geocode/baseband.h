@@ -3,6 +3,7 @@
 #include <isce3/io/forward.h>
 
 #include <complex>
+#include <vector>
 
 namespace isce3 { namespace geocode {
 /**
@@ -18,4 +19,38 @@ void baseband(isce3::core::Matrix<std::complex<float>>& data,
               const double range_pixel_spacing, const double prf,
               const isce3::core::LUT2d<double>& doppler_lut);
 
+/**
+ * Same as above, for the pixels in a range of columns of each line only
+ *
+ * The phasors removing the azimuth carrier are computed once per pixel by
+ * basebandPhasor() and may be shared by all the bands of the data.
+ *
+ * param[in,out] data a matrix of data that needs to be base-banded in azimuth
+ * param[in] phasor a matrix of azimuth carrier phasors from basebandPhasor()
+ * param[in] first_col first column to baseband in each line
+ * param[in] last_col last column to baseband in each line
+ */
+void baseband(isce3::core::Matrix<std::complex<float>>& data,
+              const isce3::core::Matrix<std::complex<float>>& phasor,
+              const std::vector<int>& first_col,
+              const std::vector<int>& last_col);
+
+/**
+ * param[out] phasor a matrix of the phasors removing the azimuth carrier of
+ *                   the data block, computed in the given columns only
+ * param[in] first_col first column to compute in each line
+ * param[in] last_col last column to compute in each line
+ * param[in] starting_range starting range of the data block
+ * param[in] sensing_start starting azimuth time of the data block
+ * param[in] range_pixel_spacing spacing of the slant range
+ * param[in] prf pulse repetition frequency
+ * param[in] doppler_lut 2D LUT of the image Doppler
+ */
+void basebandPhasor(isce3::core::Matrix<std::complex<float>>& phasor,
+                    const std::vector<int>& first_col,
+                    const std::vector<int>& last_col,
+                    const double starting_range, const double sensing_start,
+                    const double range_pixel_spacing, const double prf,
+                    const isce3::core::LUT2d<double>& doppler_lut);
+
 }} // namespace isce3::geocode
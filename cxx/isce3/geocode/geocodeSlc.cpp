@@ -1,17 +1,23 @@
 #include "geocodeSlc.h"
 
+#include <algorithm>
+#include <cmath>
+#include <complex>
 #include <memory>
+#include <vector>
 
 #include <isce3/core/Constants.h>
 #include <isce3/core/Ellipsoid.h>
 #include <isce3/core/LUT2d.h>
 #include <isce3/core/Orbit.h>
 #include <isce3/core/Projections.h>
+#include <isce3/except/Error.h>
 #include <isce3/geocode/baseband.h>
 #include <isce3/geocode/interpolate.h>
 #include <isce3/geocode/loadDem.h>
 #include <isce3/geometry/DEMInterpolator.h>
 #include <isce3/geometry/geometry.h>
+#include <isce3/io/OverviewBuilder.h>
 #include <isce3/io/Raster.h>
 #include <isce3/product/GeoGridParameters.h>
 #include <isce3/product/Product.h>
@@ -27,12 +33,44 @@ void isce3::geocode::geocodeSlc(
         const isce3::core::LUT2d<double>& imageGridDoppler,
         const isce3::core::Ellipsoid& ellipsoid, const double& thresholdGeo2rdr,
         const int& numiterGeo2rdr, const size_t& linesPerBlock,
-        const double& demBlockMargin, const bool flatten)
+        const double& demBlockMargin, const bool flatten,
+        const std::vector<int>& overviewFactors,
+        const std::string& overviewResampling,
+        const isce3::geometry::geocodeBlockTraversal blockTraversal)
 {
+    isce3::geocode::geocodeSlc(
+            std::vector<isce3::io::Raster*> {&outputRaster},
+            std::vector<isce3::io::Raster*> {&inputRaster}, demRaster,
+            radarGrid, geoGrid, orbit, nativeDoppler, imageGridDoppler,
+            ellipsoid, thresholdGeo2rdr, numiterGeo2rdr, linesPerBlock,
+            demBlockMargin, flatten, overviewFactors, overviewResampling,
+            blockTraversal);
+}
+
+void isce3::geocode::geocodeSlc(
+        const std::vector<isce3::io::Raster*>& outputRasters,
+        const std::vector<isce3::io::Raster*>& inputRasters,
+        isce3::io::Raster& demRaster,
+        const isce3::product::RadarGridParameters& radarGrid,
+        const isce3::product::GeoGridParameters& geoGrid,
+        const isce3::core::Orbit& orbit,
+        const isce3::core::LUT2d<double>& nativeDoppler,
+        const isce3::core::LUT2d<double>& imageGridDoppler,
+        const isce3::core::Ellipsoid& ellipsoid, const double& thresholdGeo2rdr,
+        const int& numiterGeo2rdr, const size_t& linesPerBlock,
+        const double& demBlockMargin, const bool flatten,
+        const std::vector<int>& overviewFactors,
+        const std::string& overviewResampling,
+        const isce3::geometry::geocodeBlockTraversal blockTraversal)
+{
+
+    // all the rasters are geocoded with the geometry of the radar grid
+    const size_t nrasters = inputRasters.size();
+    if (outputRasters.size() != nrasters) {
+        throw isce3::except::LengthError(ISCE_SRCINFO(),
+                "geocodeSlc needs one output raster per input raster");
+    }
 
-    // number of bands in the input raster
-    size_t nbands = inputRaster.numBands();
-    std::cout << "nbands: " << nbands << std::endl;
     // create projection based on _epsg code
     std::unique_ptr<isce3::core::ProjectionBase> proj(
             isce3::core::createProj(geoGrid.epsg()));
@@ -42,22 +80,31 @@ void isce3::geocode::geocodeSlc(
             isce3::core::Sinc2dInterpolator<std::complex<float>>>(
             isce3::core::SINC_LEN, isce3::core::SINC_SUB);
 
-    // Compute number of blocks in the output geocoded grid
-    size_t nBlocks = (geoGrid.length() + linesPerBlock - 1) / linesPerBlock;
+    // overviews of the output rasters, filled as their blocks are written
+    std::vector<std::unique_ptr<isce3::io::OverviewBuilder>> overviews(
+            nrasters);
+    if (!overviewFactors.empty()) {
+        for (size_t i = 0; i < nrasters; ++i)
+            overviews[i] = std::make_unique<isce3::io::OverviewBuilder>(
+                    *outputRasters[i], overviewFactors, overviewResampling);
+    }
+
+    // Blocks of the output geocoded grid, in processing order
+    const std::vector<isce3::geometry::GeoGridBlock> blocks =
+            isce3::geometry::geoGridBlocks(geoGrid.length(), geoGrid.width(),
+                                           linesPerBlock, blockTraversal);
+    const size_t nBlocks = blocks.size();
 
     std::cout << "nBlocks: " << nBlocks << std::endl;
     // loop over the blocks of the geocoded Grid
     for (size_t block = 0; block < nBlocks; ++block) {
         std::cout << "block: " << block << std::endl;
         // Get block extents (of the geocoded grid)
-        size_t lineStart, geoBlockLength;
-        lineStart = block * linesPerBlock;
-        if (block == (nBlocks - 1)) {
-            geoBlockLength = geoGrid.length() - lineStart;
-        } else {
-            geoBlockLength = linesPerBlock;
-        }
-        size_t blockSize = geoBlockLength * geoGrid.width();
+        const size_t lineStart = blocks[block].lineStart;
+        const size_t pixelStart = blocks[block].pixelStart;
+        const size_t geoBlockLength = blocks[block].length;
+        const size_t geoBlockWidth = blocks[block].width;
+        size_t blockSize = geoBlockLength * geoBlockWidth;
 
         // First and last line of the data block in radar coordinates
         int azimuthFirstLine = radarGrid.length() - 1;
@@ -70,8 +117,8 @@ void isce3::geocode::geocodeSlc(
         // get a DEM interpolator for a block of DEM for the current geocoded
         // grid
         isce3::geometry::DEMInterpolator demInterp = isce3::geocode::loadDEM(
-                demRaster, geoGrid, lineStart, geoBlockLength, geoGrid.width(),
-                demBlockMargin);
+                demRaster, geoGrid, lineStart, geoBlockLength, geoBlockWidth,
+                demBlockMargin, pixelStart);
 
         // X and Y indices (in the radar coordinates) for the
         // geocoded pixels (after geo2rdr computation)
@@ -87,40 +134,49 @@ void isce3::geocode::geocodeSlc(
         int localRangeFirstPixel = radarGrid.width() - 1;
         int localRangeLastPixel = 0;
 
-        size_t geoGridWidth = geoGrid.width();
+        // Longitude, latitude and DEM height of the output grid, with the
+        // heights interpolated a line at a time
+        std::vector<isce3::core::Vec3> llhBlock(blockSize);
+#pragma omp parallel for
+        for (size_t blockLine = 0; blockLine < geoBlockLength; ++blockLine) {
+            const double y = geoGrid.startY() +
+                             geoGrid.spacingY() * (lineStart + blockLine);
+            isce3::core::Vec3 * llhLine = &llhBlock[blockLine * geoBlockWidth];
+
+            // transform the xyz in the output projection system to llh
+            std::vector<double> x(geoBlockWidth), yLine(geoBlockWidth, y),
+                    z(geoBlockWidth, 0.0);
+            for (size_t pixel = 0; pixel < geoBlockWidth; ++pixel) {
+                x[pixel] = geoGrid.startX() +
+                           geoGrid.spacingX() * (pixelStart + pixel);
+            }
+            std::vector<double> lon(geoBlockWidth), lat(geoBlockWidth),
+                    height(geoBlockWidth);
+            proj->inverse(x.data(), yLine.data(), z.data(), lon.data(),
+                          lat.data(), height.data(), geoBlockWidth);
+
+            // interpolate the heights from the DEM for the whole line
+            demInterp.interpolateLonLat(lon.data(), lat.data(), height.data(),
+                                        geoBlockWidth);
+            for (size_t pixel = 0; pixel < geoBlockWidth; ++pixel) {
+                llhLine[pixel] = {lon[pixel], lat[pixel], height[pixel]};
+            }
+        }
+
 // Loop over lines, samples of the output grid
 #pragma omp parallel for reduction(min                                         \
                                    : localAzimuthFirstLine,                    \
                                      localRangeFirstPixel)                     \
         reduction(max                                                          \
                   : localAzimuthLastLine, localRangeLastPixel)
-        for (size_t kk = 0; kk < geoBlockLength * geoGridWidth; ++kk) {
-
-            size_t blockLine = kk / geoGridWidth;
-            size_t pixel = kk % geoGridWidth;
-
-            // Global line index
-            const size_t line = lineStart + blockLine;
-
-            // y coordinate in the out put grid
-            double y = geoGrid.startY() + geoGrid.spacingY() * line;
-
-            // x in the output geocoded Grid
-            double x = geoGrid.startX() + geoGrid.spacingX() * pixel;
+        for (size_t kk = 0; kk < blockSize; ++kk) {
 
             // compute the azimuth time and slant range for the
             // x,y coordinates in the output grid
             double aztime, srange;
             aztime = radarGrid.sensingMid();
 
-            // coordinate in the output projection system
-            const isce3::core::Vec3 xyz {x, y, 0.0};
-
-            // transform the xyz in the output projection system to llh
-            isce3::core::Vec3 llh = proj->inverse(xyz);
-
-            // interpolate the height from the DEM for this pixel
-            llh[2] = demInterp.interpolateLonLat(llh[0], llh[1]);
+            const isce3::core::Vec3 & llh = llhBlock[kk];
 
             // Perform geo->rdr iterations
             int geostat = isce3::geometry::geo2rdr(
@@ -155,8 +211,8 @@ void isce3::geocode::geocodeSlc(
                     localRangeLastPixel, static_cast<int>(std::ceil(rdrX) - 1));
 
             // store the adjusted X and Y indices
-            radarX[blockLine * geoGrid.width() + pixel] = rdrX;
-            radarY[blockLine * geoGrid.width() + pixel] = rdrY;
+            radarX[kk] = rdrX;
+            radarY[kk] = rdrY;
 
             // doppler to be added back after interpolation
             double phase =
@@ -170,7 +226,7 @@ void isce3::geocode::geocodeSlc(
             const std::complex<double> cpxPhase(std::cos(phase),
                                                 std::sin(phase));
 
-            geometricalPhase[blockLine * geoGrid.width() + pixel] = cpxPhase;
+            geometricalPhase[kk] = cpxPhase;
 
         } // end loops over lines and pixel of output grid
 
@@ -192,49 +248,107 @@ void isce3::geocode::geocodeSlc(
         isce3::core::Matrix<std::complex<float>> rdrDataBlock(rdrBlockLength,
                                                              rdrBlockWidth);
         isce3::core::Matrix<std::complex<float>> geoDataBlock(geoBlockLength,
-                                                             geoGrid.width());
+                                                             geoBlockWidth);
 
         // fill both matrices with zero
         rdrDataBlock.zeros();
         geoDataBlock.zeros();
 
-        // for each band in the input:
-        for (size_t band = 0; band < nbands; ++band) {
-
-            std::cout << "band: " << band << std::endl;
-            // get a block of data
-            std::cout << "get data block " << std::endl;
-            inputRaster.getBlock(rdrDataBlock.data(), rangeFirstPixel,
-                                 azimuthFirstLine, rdrBlockWidth,
-                                 rdrBlockLength, band + 1);
-
-            // baseband the SLC in the radar grid
-            const double blockStartingRange =
-                    radarGrid.startingRange() +
-                    rangeFirstPixel * radarGrid.rangePixelSpacing();
-            const double blockSensingStart = radarGrid.sensingStart() +
-                                             azimuthFirstLine / radarGrid.prf();
-
-            isce3::geocode::baseband(rdrDataBlock, blockStartingRange,
-                                    blockSensingStart,
-                                    radarGrid.rangePixelSpacing(),
-                                    radarGrid.prf(), nativeDoppler);
-
-            // interpolate the data in radar grid to the geocoded grid.
-            // Also the geometrical phase, which is the phase of the carrier
-            // to be added back and the geometrical phase to be removed is
-            // applied.
-            std::cout << "resample " << std::endl;
-            isce3::geocode::interpolate(rdrDataBlock, geoDataBlock, radarX,
-                                       radarY, geometricalPhase, rdrBlockWidth,
-                                       rdrBlockLength, azimuthFirstLine,
-                                       rangeFirstPixel, interp.get());
-
-            // set output
-            std::cout << "set output " << std::endl;
-            outputRaster.setBlock(geoDataBlock.data(), 0, lineStart,
-                                  geoGrid.width(), geoBlockLength, band + 1);
+        // pixels of the radar block read by the sinc interpolation of the
+        // geocoded pixels, as a range of columns in each line
+        std::vector<int> chipFirstCol, chipLastCol;
+        isce3::geocode::chipFootprint(radarX, radarY, rdrBlockWidth,
+                                      rdrBlockLength, azimuthFirstLine,
+                                      rangeFirstPixel, chipFirstCol,
+                                      chipLastCol);
+
+        // phasors removing the azimuth carrier of the SLC in the radar grid,
+        // computed only where it is interpolated and shared by all bands
+        // of all rasters
+        const double blockStartingRange =
+                radarGrid.startingRange() +
+                rangeFirstPixel * radarGrid.rangePixelSpacing();
+        const double blockSensingStart = radarGrid.sensingStart() +
+                                         azimuthFirstLine / radarGrid.prf();
+        isce3::core::Matrix<std::complex<float>> carrierPhasor(rdrBlockLength,
+                                                              rdrBlockWidth);
+        isce3::geocode::basebandPhasor(carrierPhasor, chipFirstCol,
+                                       chipLastCol, blockStartingRange,
+                                       blockSensingStart,
+                                       radarGrid.rangePixelSpacing(),
+                                       radarGrid.prf(), nativeDoppler);
+
+        // for each band of each input raster, reusing the geometry:
+        for (size_t i = 0; i < nrasters; ++i) {
+            isce3::io::Raster& inputRaster = *inputRasters[i];
+            isce3::io::Raster& outputRaster = *outputRasters[i];
+            const size_t nbands = inputRaster.numBands();
+            for (size_t band = 0; band < nbands; ++band) {
+
+                // get a block of data
+                inputRaster.getBlock(rdrDataBlock.data(), rangeFirstPixel,
+                                     azimuthFirstLine, rdrBlockWidth,
+                                     rdrBlockLength, band + 1);
+
+                // baseband the SLC in the radar grid
+                isce3::geocode::baseband(rdrDataBlock, carrierPhasor,
+                                        chipFirstCol, chipLastCol);
+
+                // interpolate the data in radar grid to the geocoded grid.
+                // Also the geometrical phase, which is the phase of the
+                // carrier to be added back and the geometrical phase to be
+                // removed is applied.
+                isce3::geocode::interpolate(
+                        rdrDataBlock, geoDataBlock, radarX, radarY,
+                        geometricalPhase, rdrBlockWidth, rdrBlockLength,
+                        azimuthFirstLine, rangeFirstPixel, interp.get());
+
+                // set output
+                outputRaster.setBlock(geoDataBlock.data(), pixelStart,
+                                      lineStart, geoBlockWidth,
+                                      geoBlockLength, band + 1);
+                if (overviews[i])
+                    overviews[i]->addBlock(geoDataBlock.data(), pixelStart,
+                                           lineStart, geoBlockWidth,
+                                           geoBlockLength, band + 1);
+            }
         }
         // set output block of data
     } // end loop over block of output grid
 }
+
+isce3::geometry::BlockMemory isce3::geocode::geocodeSlcBlockMemory(
+        isce3::io::Raster& demRaster,
+        const isce3::product::RadarGridParameters& radarGrid,
+        const isce3::product::GeoGridParameters& geoGrid,
+        const double& demBlockMargin)
+{
+    // Per geocoded pixel: radar coordinates, geometrical phase, llh and
+    // geocoded data
+    const size_t geoBytes = geoGrid.width() *
+            (2 * sizeof(double) + sizeof(std::complex<double>) +
+             sizeof(isce3::core::Vec3) + sizeof(std::complex<float>));
+
+    // Radar block and its carrier phasor, assuming the geo grid spans the
+    // radar grid along track
+    const double radarLinesPerLine =
+            double(radarGrid.length()) / std::max<size_t>(geoGrid.length(), 1);
+    const size_t rdrBytes = std::ceil(radarLinesPerLine * radarGrid.width() *
+                                      2 * sizeof(std::complex<float>));
+
+    isce3::geometry::BlockMemory memory(geoBytes + rdrBytes);
+    memory += isce3::geometry::demBlockMemory(demRaster, geoGrid,
+                                              demBlockMargin);
+    return memory;
+}
+
+size_t isce3::geocode::geocodeSlcLinesPerBlock(
+        isce3::io::Raster& demRaster,
+        const isce3::product::RadarGridParameters& radarGrid,
+        const isce3::product::GeoGridParameters& geoGrid,
+        const double& demBlockMargin, const size_t& memoryBudget)
+{
+    return geocodeSlcBlockMemory(demRaster, radarGrid, geoGrid,
+                                 demBlockMargin)
+            .linesPerBlock(memoryBudget, geoGrid.length());
+}
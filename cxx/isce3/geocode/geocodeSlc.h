@@ -1,6 +1,10 @@
 #pragma once
 #include <cstddef>
+#include <string>
+#include <vector>
 #include <isce3/core/forward.h>
+#include <isce3/geometry/BlockMemory.h>
+#include <isce3/geometry/GeoGridBlocks.h>
 #include <isce3/io/forward.h>
 #include <isce3/product/forward.h>
 
@@ -22,6 +26,14 @@ namespace isce3 { namespace geocode {
  * \param[in]  linesPerBlock     number of lines in each block
  * \param[in]  demBlockMargin    margin of a DEM block in degrees
  * \param[in]  flatten           flag to flatten the geocoded SLC
+ * \param[in]  overviewFactors   decimation factors of the overview levels
+ * built from the output blocks as they are written (empty to disable)
+ * \param[in]  overviewResampling  overview resampling method ("NEAREST" or
+ * "AVERAGE"). Averaging complex samples cancels their random phase, hence
+ * the nearest neighbor default.
+ * \param[in]  blockTraversal    shape and order of the blocks of the geocoded
+ * grid. HILBERT_TILES keeps the radar block of each block compact when the
+ * swath is rotated with respect to the grid (e.g. at high latitudes).
  */
 void geocodeSlc(isce3::io::Raster& outputRaster, isce3::io::Raster& inputRaster,
                 isce3::io::Raster& demRaster,
@@ -33,6 +45,70 @@ void geocodeSlc(isce3::io::Raster& outputRaster, isce3::io::Raster& inputRaster,
                 const isce3::core::Ellipsoid& ellipsoid,
                 const double& thresholdGeo2rdr, const int& numiterGeo2rdr,
                 const size_t& linesPerBlock, const double& demBlockMargin,
-                const bool flatten = true);
+                const bool flatten = true,
+                const std::vector<int>& overviewFactors = {},
+                const std::string& overviewResampling = "NEAREST",
+                const isce3::geometry::geocodeBlockTraversal blockTraversal =
+                        isce3::geometry::BLOCKS_OF_LINES);
+
+/**
+ * Geocode several SLC rasters sharing the same radar grid in a single pass
+ * (e.g. the polarizations of a frequency). The geometry of each block
+ * (geo2rdr, geometrical phase, sinc chip footprint and azimuth carrier) is
+ * computed once and applied to every band of every raster.
+ * \param[out] outputRasters output rasters for the geocoded SLCs
+ * \param[in]  inputRasters  input rasters of the SLCs in radar coordinates,
+ * one per output raster
+ *
+ * The other parameters are the same as above; overviews are built for each
+ * output raster.
+ */
+void geocodeSlc(const std::vector<isce3::io::Raster*>& outputRasters,
+                const std::vector<isce3::io::Raster*>& inputRasters,
+                isce3::io::Raster& demRaster,
+                const isce3::product::RadarGridParameters& radarGrid,
+                const isce3::product::GeoGridParameters& geoGrid,
+                const isce3::core::Orbit& orbit,
+                const isce3::core::LUT2d<double>& nativeDoppler,
+                const isce3::core::LUT2d<double>& imageGridDoppler,
+                const isce3::core::Ellipsoid& ellipsoid,
+                const double& thresholdGeo2rdr, const int& numiterGeo2rdr,
+                const size_t& linesPerBlock, const double& demBlockMargin,
+                const bool flatten = true,
+                const std::vector<int>& overviewFactors = {},
+                const std::string& overviewResampling = "NEAREST",
+                const isce3::geometry::geocodeBlockTraversal blockTraversal =
+                        isce3::geometry::BLOCKS_OF_LINES);
+
+/**
+ * Memory footprint of geocodeSlc, to derive the number of lines per block
+ * from a memory budget with BlockMemory::linesPerBlock. The rasters are
+ * geocoded one after the other, so the footprint does not depend on their
+ * number.
+ * \param[in]  demRaster       raster of the DEM
+ * \param[in]  radarGrid       radar grid parameters
+ * \param[in]  geoGrid         geo grid parameters
+ * \param[in]  demBlockMargin  margin of a DEM block in degrees
+ */
+isce3::geometry::BlockMemory
+geocodeSlcBlockMemory(isce3::io::Raster& demRaster,
+                      const isce3::product::RadarGridParameters& radarGrid,
+                      const isce3::product::GeoGridParameters& geoGrid,
+                      const double& demBlockMargin);
+
+/**
+ * Number of lines per block of geocodeSlc whose peak memory fits in a
+ * memory budget, as predicted by geocodeSlcBlockMemory
+ * \param[in]  demRaster       raster of the DEM
+ * \param[in]  radarGrid       radar grid parameters
+ * \param[in]  geoGrid         geo grid parameters
+ * \param[in]  demBlockMargin  margin of a DEM block in degrees
+ * \param[in]  memoryBudget    memory budget (bytes)
+ */
+size_t geocodeSlcLinesPerBlock(
+        isce3::io::Raster& demRaster,
+        const isce3::product::RadarGridParameters& radarGrid,
+        const isce3::product::GeoGridParameters& geoGrid,
+        const double& demBlockMargin, const size_t& memoryBudget);
 
 }} // namespace isce3::geocode
@@ -1,5 +1,7 @@
 #include "interpolate.h"
 
+#include <algorithm>
+
 void isce3::geocode::interpolate(
         const isce3::core::Matrix<std::complex<float>>& rdrDataBlock,
         isce3::core::Matrix<std::complex<float>>& geoDataBlock,
@@ -45,3 +47,53 @@ void isce3::geocode::interpolate(
         }
     } // end for
 }
+
+void isce3::geocode::chipFootprint(const std::valarray<double>& radarX,
+                                   const std::valarray<double>& radarY,
+                                   const int radarBlockWidth,
+                                   const int radarBlockLength,
+                                   const int azimuthFirstLine,
+                                   const int rangeFirstPixel,
+                                   std::vector<int>& first_col,
+                                   std::vector<int>& last_col)
+{
+    const int extraMargin = isce3::core::SINC_HALF;
+    first_col.assign(radarBlockLength, radarBlockWidth);
+    last_col.assign(radarBlockLength, -1);
+
+#pragma omp parallel
+    {
+        // Column range of each line over the pixels of this thread
+        std::vector<int> local_first(radarBlockLength, radarBlockWidth);
+        std::vector<int> local_last(radarBlockLength, -1);
+
+#pragma omp for
+        for (size_t k = 0; k < radarX.size(); ++k) {
+
+            // same validity check as interpolate()
+            const double rdrY = radarY[k] - azimuthFirstLine;
+            const double rdrX = radarX[k] - rangeFirstPixel;
+            if (rdrX < extraMargin || rdrY < extraMargin ||
+                rdrX >= (radarBlockWidth - extraMargin) ||
+                rdrY >= (radarBlockLength - extraMargin))
+                continue;
+
+            // sinc chip around the pixel
+            const int ix = static_cast<int>(std::floor(rdrX));
+            const int iy = static_cast<int>(std::floor(rdrY));
+            const int col0 = ix - isce3::core::SINC_HALF + 1;
+            const int col1 = ix + isce3::core::SINC_HALF;
+            for (int line = iy - isce3::core::SINC_HALF + 1;
+                 line <= iy + isce3::core::SINC_HALF; ++line) {
+                local_first[line] = std::min(local_first[line], col0);
+                local_last[line] = std::max(local_last[line], col1);
+            }
+        }
+
+#pragma omp critical
+        for (int line = 0; line < radarBlockLength; ++line) {
+            first_col[line] = std::min(first_col[line], local_first[line]);
+            last_col[line] = std::max(last_col[line], local_last[line]);
+        }
+    }
+}
@@ -3,6 +3,7 @@
 
 #include <complex>
 #include <iostream>
+#include <vector>
 
 #include <isce3/core/Interpolator.h>
 #include <isce3/core/Matrix.h>
@@ -30,4 +31,24 @@ void interpolate(const isce3::core::Matrix<std::complex<float>>& rdrDataBlock,
                  const int azimuthFirstLine, const int rangeFirstPixel,
                  const isce3::core::Interpolator<std::complex<float>>* interp);
 
+/**
+ * Find the pixels of a radar data block read by interpolate() with a sinc
+ * interpolator of length SINC_LEN, as a range of columns in each line.
+ * Lines that are not read get an empty range (first_col > last_col).
+ *
+ * @param[in] radarX the radar-coordinates x-index of the pixels in geo-grid
+ * @param[in] radarY the radar-coordinates y-index of the pixels in geo-grid
+ * @param[in] radarBlockWidth width of the data block in radar coordinates
+ * @param[in] radarBlockLength length of the data block in radar coordinates
+ * @param[in] azimuthFirstLine azimuth time of the first sample
+ * @param[in] rangeFirstPixel  range of the first sample
+ * @param[out] first_col first column read in each line of the block
+ * @param[out] last_col last column read in each line of the block
+ */
+void chipFootprint(const std::valarray<double>& radarX,
+                   const std::valarray<double>& radarY,
+                   const int radarBlockWidth, const int radarBlockLength,
+                   const int azimuthFirstLine, const int rangeFirstPixel,
+                   std::vector<int>& first_col, std::vector<int>& last_col);
+
 }} // namespace isce3::geocode
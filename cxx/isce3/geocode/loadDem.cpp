@@ -5,7 +5,7 @@ isce3::geometry::DEMInterpolator
 isce3::geocode::loadDEM(isce3::io::Raster& demRaster,
                        const isce3::product::GeoGridParameters& geoGrid,
                        int lineStart, int blockLength, int blockWidth,
-                       double demMargin)
+                       double demMargin, int pixelStart)
 {
     // DEM interpolator
     isce3::geometry::DEMInterpolator demInterp;
@@ -62,7 +62,7 @@ isce3::geocode::loadDEM(isce3::io::Raster& demRaster,
         // Loop over the indices
         for (size_t i = 0; i < lineInd.size(); i++) {
             isce3::core::Vec3 outpt = {
-                    geoGrid.startX() + geoGrid.spacingX() * pixInd[i],
+                    geoGrid.startX() + geoGrid.spacingX() * (pixelStart + pixInd[i]),
                     geoGrid.startY() + geoGrid.spacingY() * (lineStart + lineInd[i]), 0.0};
 
             isce3::core::Vec3 dempt;
@@ -82,8 +82,9 @@ isce3::geocode::loadDEM(isce3::io::Raster& demRaster,
         maxY = geoGrid.startY() + geoGrid.spacingY() * lineStart;
         minY = geoGrid.startY() +
                geoGrid.spacingY() * (lineStart + blockLength - 1);
-        minX = geoGrid.startX();
-        maxX = geoGrid.startX() + geoGrid.spacingX() * (blockWidth - 1);
+        minX = geoGrid.startX() + geoGrid.spacingX() * pixelStart;
+        maxX = geoGrid.startX() +
+               geoGrid.spacingX() * (pixelStart + blockWidth - 1);
     }
 
     // If not LonLat, scale to meters
@@ -15,9 +15,11 @@ namespace isce3 { namespace geocode {
  * @param[in] blockLength length of the block of interest in the eocoded grid
  * @param[in] blockWidth  width of the block of interest in the eocoded grid
  * @param[in] demMargin  extra margin for the dem relative to the geocoded grid
+ * @param[in] pixelStart start pixel of the block of interest in the geocoded grid
  */
 isce3::geometry::DEMInterpolator
 loadDEM(isce3::io::Raster& demRaster,
         const isce3::product::GeoGridParameters& geoGrid, int lineStart,
-        int blockLength, int blockWidth, double demMargin);
+        int blockLength, int blockWidth, double demMargin,
+        int pixelStart = 0);
 }} // namespace isce3::geocode
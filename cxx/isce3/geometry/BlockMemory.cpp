@@ -0,0 +1,111 @@
+#include "BlockMemory.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+#include <isce3/core/Constants.h>
+#include <isce3/core/Projections.h>
+#include <isce3/io/Raster.h>
+#include <isce3/product/GeoGridParameters.h>
+
+/**
+ * @param[in] memoryBudget Memory budget (bytes)
+ * @param[in] gridLength Number of lines of the processed grid */
+size_t isce3::geometry::BlockMemory::
+linesPerBlock(size_t memoryBudget, size_t gridLength) const {
+    if (_bytesPerLine == 0) {
+        return std::max<size_t>(gridLength, 1);
+    }
+    // at least one line per block, even over budget
+    const size_t lines = memoryBudget > _fixedBytes ?
+            (memoryBudget - _fixedBytes) / _bytesPerLine : 0;
+    return std::max<size_t>(std::min(lines, gridLength), 1);
+}
+
+isce3::geometry::BlockMemory
+isce3::geometry::demBlockMemory(isce3::io::Raster & demRaster, double minX,
+                                double maxX, double minY, double maxY,
+                                double margin, size_t gridLength) {
+
+    if (gridLength == 0 || !(maxX >= minX) || !(maxY >= minY)) {
+        return BlockMemory();
+    }
+
+    // margins are in meters unless the DEM is in LonLat
+    if (demRaster.getEPSG() != 4326) {
+        margin = isce3::core::decimaldeg2meters(margin);
+    }
+
+    // DEM pixels over the grid, within the raster
+    const double dx = std::abs(demRaster.dx());
+    const double dy = std::abs(demRaster.dy());
+    const double width = std::min<double>(demRaster.width(),
+            std::ceil((maxX - minX + 2 * margin) / dx) + 1);
+    const double length = std::min<double>(demRaster.length(),
+            std::ceil((maxY - minY) / dy));
+    const double marginLength = std::min<double>(demRaster.length(),
+            std::ceil(2 * margin / dy) + 1);
+
+    return BlockMemory(
+            std::ceil(width * length / gridLength * sizeof(float)),
+            width * marginLength * sizeof(float));
+}
+
+isce3::geometry::BlockMemory
+isce3::geometry::demBlockMemory(isce3::io::Raster & demRaster,
+                                const isce3::product::GeoGridParameters & geoGrid,
+                                double margin) {
+
+    double minX = std::numeric_limits<double>::max();
+    double maxX = std::numeric_limits<double>::lowest();
+    double minY = std::numeric_limits<double>::max();
+    double maxY = std::numeric_limits<double>::lowest();
+
+    const int epsgcode = demRaster.getEPSG();
+    if (epsgcode == geoGrid.epsg()) {
+        // Use the corners directly as the projection system is the same
+        const double x1 = geoGrid.startX();
+        const double x2 = geoGrid.startX() + geoGrid.spacingX() * geoGrid.width();
+        const double y1 = geoGrid.startY();
+        const double y2 = geoGrid.startY() + geoGrid.spacingY() * geoGrid.length();
+        minX = std::min(x1, x2);
+        maxX = std::max(x1, x2);
+        minY = std::min(y1, y2);
+        maxY = std::max(y1, y2);
+    } else {
+        std::unique_ptr<isce3::core::ProjectionBase> proj(
+                isce3::core::createProj(geoGrid.epsg()));
+        std::unique_ptr<isce3::core::ProjectionBase> demproj(
+                isce3::core::createProj(epsgcode));
+
+        // Traverse the perimeter of the grid, 10 points per edge
+        const int nedge = 10;
+        for (int k = 0; k <= 4 * nedge; ++k) {
+            const int edge = std::min(k / nedge, 3);
+            const double f = double(k - edge * nedge) / nedge;
+            double pixel, line;
+            switch (edge) {
+                case 0: pixel = f; line = 0; break;
+                case 1: pixel = 1; line = f; break;
+                case 2: pixel = 1 - f; line = 1; break;
+                default: pixel = 0; line = 1 - f; break;
+            }
+            isce3::core::Vec3 outpt = {
+                    geoGrid.startX() + geoGrid.spacingX() * geoGrid.width() * pixel,
+                    geoGrid.startY() + geoGrid.spacingY() * geoGrid.length() * line,
+                    0.0};
+            isce3::core::Vec3 dempt;
+            if (!projTransform(proj.get(), demproj.get(), outpt, dempt)) {
+                minX = std::min(minX, dempt[0]);
+                maxX = std::max(maxX, dempt[0]);
+                minY = std::min(minY, dempt[1]);
+                maxY = std::max(maxY, dempt[1]);
+            }
+        }
+    }
+
+    return demBlockMemory(demRaster, minX, maxX, minY, maxY, margin,
+                          geoGrid.length());
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "forward.h"
+
+#include <cstddef>
+
+#include <isce3/io/forward.h>
+#include <isce3/product/forward.h>
+
+/** Memory footprint of an algorithm processing a grid in blocks of lines
+ *
+ * The buffers allocated for a block of n lines are modeled as a fixed part
+ * plus a part proportional to n, so that the number of lines per block can
+ * be derived from a memory budget, and the peak memory predicted before
+ * processing. The footprints of the buffers of an algorithm add up.
+ *
+ * DEM tiles kept by DEMTileCache are bounded by the budget of the cache and
+ * not included.
+ */
+class isce3::geometry::BlockMemory {
+
+    public:
+        /** Constructor
+         *
+         * @param[in] bytesPerLine Bytes allocated per line of the block
+         * @param[in] fixedBytes   Bytes allocated regardless of the block
+         * length */
+        explicit BlockMemory(size_t bytesPerLine = 0, size_t fixedBytes = 0) :
+            _bytesPerLine(bytesPerLine), _fixedBytes(fixedBytes) {}
+
+        /** Bytes allocated per line of the block */
+        size_t bytesPerLine() const { return _bytesPerLine; }
+
+        /** Bytes allocated regardless of the block length */
+        size_t fixedBytes() const { return _fixedBytes; }
+
+        /** Add the footprint of other buffers */
+        BlockMemory & operator+=(const BlockMemory & other) {
+            _bytesPerLine += other._bytesPerLine;
+            _fixedBytes += other._fixedBytes;
+            return *this;
+        }
+
+        /** Peak memory of blocks of given number of lines (bytes) */
+        size_t peak(size_t linesPerBlock) const {
+            return _fixedBytes + linesPerBlock * _bytesPerLine;
+        }
+
+        /** Largest number of lines per block whose peak memory fits in a
+         * budget, between 1 and the length of the grid
+         *
+         * @param[in] memoryBudget Memory budget (bytes)
+         * @param[in] gridLength   Number of lines of the processed grid */
+        size_t linesPerBlock(size_t memoryBudget, size_t gridLength) const;
+
+    private:
+        size_t _bytesPerLine;
+        size_t _fixedBytes;
+};
+
+namespace isce3 { namespace geometry {
+
+/** Footprint of the DEM blocks loaded for the blocks of lines of a grid
+ *
+ * Each block loads the DEM over the whole width of the bounding box of the
+ * grid, and a share of its length proportional to the number of lines of
+ * the block, plus a margin on each side.
+ *
+ * @param[in] demRaster  DEM raster
+ * @param[in] minX       Minimum X of the grid in DEM coordinates
+ * @param[in] maxX       Maximum X of the grid in DEM coordinates
+ * @param[in] minY       Minimum Y of the grid in DEM coordinates
+ * @param[in] maxY       Maximum Y of the grid in DEM coordinates
+ * @param[in] margin     Margin around each DEM block in decimal degrees
+ * @param[in] gridLength Number of lines of the grid */
+BlockMemory demBlockMemory(isce3::io::Raster & demRaster, double minX,
+                           double maxX, double minY, double maxY,
+                           double margin, size_t gridLength);
+
+/** Footprint of the DEM blocks loaded for the blocks of lines of a geocoded
+ * grid
+ *
+ * @param[in] demRaster DEM raster
+ * @param[in] geoGrid   Geocoded grid
+ * @param[in] margin    Margin around each DEM block in decimal degrees */
+BlockMemory demBlockMemory(isce3::io::Raster & demRaster,
+                           const isce3::product::GeoGridParameters & geoGrid,
+                           double margin);
+
+}}
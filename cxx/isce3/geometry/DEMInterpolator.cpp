@@ -6,10 +6,74 @@
 //
 
 #include "DEMInterpolator.h"
+#include "DEMTileCache.h"
+
+#include <algorithm>
+#include <cmath>
 
 #include <isce3/core/Projections.h>
+#include <isce3/io/ConcurrentRasterReader.h>
 #include <isce3/io/Raster.h>
 
+// Read a block of the DEM through the shared tile cache, which reads from
+// the memory map of the file if possible
+static void readDEMBlock(isce3::io::Raster & demRaster, float * dem,
+                         int xstart, int ystart, int width, int length) {
+    isce3::geometry::DEMTileCache::instance().getBlock(
+            demRaster, dem, xstart, ystart, width, length);
+}
+
+static void readDEMBlock(isce3::io::ConcurrentRasterReader & demReader,
+                         float * dem, int xstart, int ystart, int width,
+                         int length) {
+    isce3::geometry::DEMTileCache::instance().getBlock(
+            demReader, dem, xstart, ystart, width, length);
+}
+
+// Number of points processed at a time by the batched interpolation
+static constexpr size_t batchChunk = 64;
+
+// Interpolate the DEM at a batch of native coordinates, dispatching the
+// interpolator once per chunk
+static void interpolateBatch(const isce3::core::Interpolator<float> & interp,
+                             const isce3::core::Matrix<float> & dem,
+                             double xstart, double ystart, double deltax,
+                             double deltay, double refHeight,
+                             const double * x, const double * y, double * z,
+                             size_t n) {
+    const int width = dem.width();
+    const int length = dem.length();
+    double rows[batchChunk], cols[batchChunk];
+    float values[batchChunk];
+    size_t index[batchChunk];
+    for (size_t start = 0; start < n; start += batchChunk) {
+        const size_t count = std::min(batchChunk, n - start);
+
+        // Fractional DEM indices of the points inside the DEM; the others
+        // get the reference height
+        size_t nvalid = 0;
+        for (size_t k = 0; k < count; ++k) {
+            const double row = (y[start + k] - ystart) / deltay;
+            const double col = (x[start + k] - xstart) / deltax;
+            const int irow = int(std::floor(row));
+            const int icol = int(std::floor(col));
+            if (irow < 2 || irow >= length - 1 ||
+                icol < 2 || icol >= width - 1) {
+                z[start + k] = refHeight;
+            } else {
+                rows[nvalid] = row;
+                cols[nvalid] = col;
+                index[nvalid++] = start + k;
+            }
+        }
+
+        interp.interpolate(cols, rows, nvalid, dem, values);
+        for (size_t k = 0; k < nvalid; ++k) {
+            z[index[k]] = values[k];
+        }
+    }
+}
+
 isce3::geometry::DEMInterpolator::
 ~DEMInterpolator() {
     if (_interp) {
@@ -31,6 +95,27 @@ isce3::geometry::DEMInterpolator::
 void isce3::geometry::DEMInterpolator::
 loadDEM(isce3::io::Raster & demRaster, double minX, double maxX,
         double minY, double maxY) {
+    _loadDEMSubset(demRaster, minX, maxX, minY, maxY);
+}
+
+/** @param[in] demReader reader of the input DEM raster to subset
+  * @param[in] minLon Longitude of western edge of bounding box
+  * @param[in] maxLon Longitude of eastern edge of bounding box
+  * @param[in] minLat Latitude of southern edge of bounding box
+  * @param[in] maxLat Latitude of northern edge of bounding box
+  *
+  * Same as above, but may be called concurrently from multiple threads
+  * (each with its own DEMInterpolator) */
+void isce3::geometry::DEMInterpolator::
+loadDEM(isce3::io::ConcurrentRasterReader & demReader, double minX,
+        double maxX, double minY, double maxY) {
+    _loadDEMSubset(demReader, minX, maxX, minY, maxY);
+}
+
+template<class DEMSource>
+void isce3::geometry::DEMInterpolator::
+_loadDEMSubset(DEMSource & demRaster, double minX, double maxX,
+               double minY, double maxY) {
 
     // Initialize journal
     pyre::journal::warning_t warning("isce.core.Geometry");
@@ -92,7 +177,7 @@ loadDEM(isce3::io::Raster & demRaster, double minX, double maxX,
     _dem.resize(length, width);
 
     // Read in the DEM
-    demRaster.getBlock(_dem.data(), xstart, ystart, width, length);
+    readDEMBlock(demRaster, _dem.data(), xstart, ystart, width, length);
 
     // Initialize internal interpolator
     _interp = isce3::core::createInterpolator<float>(_interpMethod);
@@ -138,7 +223,8 @@ loadDEM(isce3::io::Raster & demRaster) {
     _dem.resize(length, width);
 
     // Read in the DEM
-    demRaster.getBlock(_dem.data(), 0, 0, width, length);
+    demRaster.memmapBands();
+    demRaster.getBlockMapped(_dem.data(), 0, 0, width, length);
 
     // Initialize internal interpolator
     _interp = isce3::core::createInterpolator<float>(_interpMethod);
@@ -257,4 +343,49 @@ interpolateXY(double x, double y) const {
     return _interp->interpolate(col, row, _dem);
 }
 
+/** @param[in] lon Longitudes of interpolation points.
+  * @param[in] lat Latitudes of interpolation points.
+  * @param[out] z Interpolated heights.
+  * @param[in] n Number of interpolation points.
+  *
+  * Interpolate DEM at arrays of longitudes and latitudes */
+void isce3::geometry::DEMInterpolator::
+interpolateLonLat(const double * lon, const double * lat, double * z,
+                  size_t n) const {
+
+    // If we don't have a DEM, just return reference height
+    if (!_haveRaster) {
+        std::fill(z, z + n, double(_refHeight));
+        return;
+    }
+
+    // Pass chunks of points through projection, then interpolate them
+    const double h[batchChunk] = {};
+    double x[batchChunk], y[batchChunk], zproj[batchChunk];
+    for (size_t start = 0; start < n; start += batchChunk) {
+        const size_t count = std::min(batchChunk, n - start);
+        _proj->forward(lon + start, lat + start, h, x, y, zproj, count);
+        interpolateXY(x, y, z + start, count);
+    }
+}
+
+/** @param[in] x X-coordinates of interpolation points.
+  * @param[in] y Y-coordinates of interpolation points.
+  * @param[out] z Interpolated heights.
+  * @param[in] n Number of interpolation points.
+  *
+  * Interpolate DEM at arrays of native coordinates */
+void isce3::geometry::DEMInterpolator::
+interpolateXY(const double * x, const double * y, double * z, size_t n) const {
+
+    // If we don't have a DEM, just return reference height
+    if (!_haveRaster) {
+        std::fill(z, z + n, double(_refHeight));
+        return;
+    }
+
+    interpolateBatch(*_interp, _dem, _xstart, _ystart, _deltax, _deltay,
+                     _refHeight, x, y, z, n);
+}
+
 // end of file
@@ -60,6 +60,12 @@ class isce3::geometry::DEMInterpolator {
                      double minX, double maxX,
                      double minY, double maxY);
 
+        /** Read in subset of data from a DEM with a supported projection
+         * through a reader shared by threads loading DEM blocks concurrently */
+        void loadDEM(isce3::io::ConcurrentRasterReader &demReader,
+                     double minX, double maxX,
+                     double minY, double maxY);
+
         /** Read in entire DEM with a supported projection */
         void loadDEM(isce3::io::Raster &demRaster);
 
@@ -75,6 +81,28 @@ class isce3::geometry::DEMInterpolator {
         /** Interpolate at native XY coordinates of DEM */
         double interpolateXY(double x, double y) const;
 
+        /** Interpolate at arrays of longitudes and latitudes
+         *
+         * @param[in]  lon Longitudes of the interpolation points
+         * @param[in]  lat Latitudes of the interpolation points
+         * @param[out] z   Interpolated heights
+         * @param[in]  n   Number of interpolation points */
+        void interpolateLonLat(const double * lon, const double * lat,
+                               double * z, size_t n) const;
+
+        /** Interpolate at arrays of native XY coordinates of DEM
+         *
+         * Same values as interpolateXY(x, y) at each point, with the
+         * bilinear and bicubic kernels evaluated inline instead of through
+         * the Interpolator interface.
+         *
+         * @param[in]  x X-coordinates of the interpolation points
+         * @param[in]  y Y-coordinates of the interpolation points
+         * @param[out] z Interpolated heights
+         * @param[in]  n Number of interpolation points */
+        void interpolateXY(const double * x, const double * y, double * z,
+                           size_t n) const;
+
         /** Get starting X coordinate */
         double xStart() const { return _xstart; }
         /** Set starting X coordinate */
@@ -147,6 +175,11 @@ class isce3::geometry::DEMInterpolator {
         }
 
     private:
+        // Read in subset of data from a Raster or ConcurrentRasterReader
+        template<class DEMSource>
+        void _loadDEMSubset(DEMSource &demSource, double minX, double maxX,
+                            double minY, double maxY);
+
         // Flag indicating whether we have access to a DEM raster
         bool _haveRaster;
         // Constant value if no raster is provided
@@ -0,0 +1,255 @@
+#include "DEMTileCache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cpl_vsi.h>
+#include <isce3/except/Error.h>
+#include <isce3/io/ConcurrentRasterReader.h>
+#include <isce3/io/Raster.h>
+
+// Identifier of the contents of a DEM file, or an empty string if the file
+// cannot be identified. The modification time is taken to the nanosecond
+// and the inode is included, so that a file rewritten within the same
+// second, or replaced by another one, is not mistaken for the original.
+static std::string demSource(const std::string & filename, size_t width,
+                             size_t length) {
+    VSIStatBufL stat;
+    if (filename.empty() || VSIStatL(filename.c_str(), &stat) != 0) {
+        return std::string();
+    }
+#ifdef __APPLE__
+    const auto & mtime = stat.st_mtimespec;
+#else
+    const auto & mtime = stat.st_mtim;
+#endif
+    return filename + ":" + std::to_string(stat.st_ino) + ":" +
+           std::to_string(mtime.tv_sec) + "." +
+           std::to_string(mtime.tv_nsec) + ":" +
+           std::to_string(stat.st_size) + ":" + std::to_string(width) + "x" +
+           std::to_string(length);
+}
+
+/**
+ * @param[in] memoryBudget Maximum memory held by the tiles (bytes)
+ * @param[in] tileSize Width and length of the tiles (pixels) */
+isce3::geometry::DEMTileCache::
+DEMTileCache(size_t memoryBudget, int tileSize) :
+    _memoryBudget(memoryBudget),
+    _tileSize(tileSize)
+{
+    if (tileSize < 1) {
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(),
+                "DEM tile size must be positive");
+    }
+}
+
+isce3::geometry::DEMTileCache &
+isce3::geometry::DEMTileCache::
+instance() {
+    static DEMTileCache cache;
+    return cache;
+}
+
+size_t isce3::geometry::DEMTileCache::
+memoryBudget() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _memoryBudget;
+}
+
+void isce3::geometry::DEMTileCache::
+memoryBudget(size_t budget) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _memoryBudget = budget;
+    _evict();
+}
+
+size_t isce3::geometry::DEMTileCache::
+memoryUsage() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _memoryUsage;
+}
+
+void isce3::geometry::DEMTileCache::
+clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _tiles.clear();
+    _lru.clear();
+    _memoryUsage = 0;
+    _hits = 0;
+    _misses = 0;
+}
+
+/**
+ * @param[in] demRaster DEM raster
+ * @param[out] dem Buffer of width x length pixels
+ * @param[in] xstart Pixel index of the block (0-based)
+ * @param[in] ystart Line index of the block (0-based)
+ * @param[in] width Number of pixels in the block
+ * @param[in] length Number of lines in the block */
+void isce3::geometry::DEMTileCache::
+getBlock(isce3::io::Raster & demRaster, float * dem, int xstart, int ystart,
+         int width, int length) {
+
+    demRaster.memmapBands();
+    auto read = [&demRaster](float * buffer, int x, int y, int w, int l) {
+        demRaster.getBlockMapped(buffer, x, y, w, l);
+    };
+
+    // Only files opened read-only are guaranteed to match their contents
+    // on disk
+    std::string source;
+    GDALDataset * dataset = demRaster.dataset();
+    if (demRaster.access() == GA_ReadOnly &&
+        std::string(dataset->GetDriver()->GetDescription()) != "MEM") {
+        source = demSource(dataset->GetDescription(), demRaster.width(),
+                           demRaster.length());
+    }
+    _getBlock(source, demRaster.width(), demRaster.length(), read, dem,
+              xstart, ystart, width, length);
+}
+
+/**
+ * @param[in] demReader Reader of the DEM raster
+ * @param[out] dem Buffer of width x length pixels
+ * @param[in] xstart Pixel index of the block (0-based)
+ * @param[in] ystart Line index of the block (0-based)
+ * @param[in] width Number of pixels in the block
+ * @param[in] length Number of lines in the block */
+void isce3::geometry::DEMTileCache::
+getBlock(isce3::io::ConcurrentRasterReader & demReader, float * dem,
+         int xstart, int ystart, int width, int length) {
+
+    auto read = [&demReader](float * buffer, int x, int y, int w, int l) {
+        demReader.getBlock(buffer, x, y, w, l);
+    };
+
+    // Readers that cannot reopen the file by name read MEM datasets or
+    // rasters opened for update
+    std::string source;
+    if (demReader.concurrent()) {
+        source = demSource(demReader.filename(), demReader.width(),
+                           demReader.length());
+    }
+    _getBlock(source, demReader.width(), demReader.length(), read, dem,
+              xstart, ystart, width, length);
+}
+
+void isce3::geometry::DEMTileCache::
+_getBlock(const std::string & source, int demWidth, int demLength,
+          const ReadFunction & read, float * dem, int xstart, int ystart,
+          int width, int length) {
+
+    if (xstart < 0 || ystart < 0 || xstart + width > demWidth ||
+        ystart + length > demLength) {
+        throw isce3::except::OutOfRange(ISCE_SRCINFO(),
+                "DEM block extends past the edge of the raster");
+    }
+    if (width <= 0 || length <= 0) {
+        return;
+    }
+    if (source.empty() || memoryBudget() == 0) {
+        read(dem, xstart, ystart, width, length);
+        return;
+    }
+
+    // Copy the part of each tile overlapping the block
+    for (int tileY = ystart / _tileSize;
+         tileY <= (ystart + length - 1) / _tileSize; ++tileY) {
+        for (int tileX = xstart / _tileSize;
+             tileX <= (xstart + width - 1) / _tileSize; ++tileX) {
+
+            const Tile tile = _getTile(source, tileX, tileY, demWidth,
+                                       demLength, read);
+            const int tx0 = tileX * _tileSize;
+            const int ty0 = tileY * _tileSize;
+            const int tileWidth = std::min(_tileSize, demWidth - tx0);
+
+            const int x0 = std::max(xstart, tx0);
+            const int x1 = std::min(xstart + width, tx0 + tileWidth);
+            const int y0 = std::max(ystart, ty0);
+            const int y1 = std::min(ystart + length, ty0 + _tileSize);
+            for (int y = y0; y < y1; ++y) {
+                const float * row = tile->data() +
+                        size_t(y - ty0) * tileWidth + (x0 - tx0);
+                std::copy(row, row + (x1 - x0),
+                          dem + size_t(y - ystart) * width + (x0 - xstart));
+            }
+        }
+    }
+}
+
+isce3::geometry::DEMTileCache::Tile
+isce3::geometry::DEMTileCache::
+_getTile(const std::string & source, int tileX, int tileY, int demWidth,
+         int demLength, const ReadFunction & read) {
+
+    const int tx0 = tileX * _tileSize;
+    const int ty0 = tileY * _tileSize;
+    const int tileWidth = std::min(_tileSize, demWidth - tx0);
+    const int tileLength = std::min(_tileSize, demLength - ty0);
+
+    const Key key(source, tileX, tileY);
+    std::promise<Tile> promise;
+    std::shared_future<Tile> future;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _tiles.find(key);
+        if (it != _tiles.end()) {
+            ++_hits;
+            _lru.splice(_lru.begin(), _lru, it->second.lru);
+            future = it->second.tile;
+        } else {
+            ++_misses;
+            _lru.push_front(key);
+            Entry & entry = _tiles[key];
+            entry.tile = promise.get_future().share();
+            entry.bytes = size_t(tileWidth) * tileLength * sizeof(float);
+            entry.lru = _lru.begin();
+            _memoryUsage += entry.bytes;
+            _evict();
+        }
+    }
+
+    // Wait for the tile read by another thread
+    if (future.valid()) {
+        return future.get();
+    }
+
+    // Read the tile without holding the lock
+    try {
+        auto tile = std::make_shared<std::vector<float>>(
+                size_t(tileWidth) * tileLength);
+        read(tile->data(), tx0, ty0, tileWidth, tileLength);
+        promise.set_value(tile);
+        return tile;
+    } catch (...) {
+        // Forget the tile so that it is read again on the next lookup
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _tiles.find(key);
+            if (it != _tiles.end()) {
+                _memoryUsage -= it->second.bytes;
+                _lru.erase(it->second.lru);
+                _tiles.erase(it);
+            }
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+}
+
+void isce3::geometry::DEMTileCache::
+_evict() {
+    auto it = _lru.end();
+    while (_memoryUsage > _memoryBudget && it != _lru.begin()) {
+        --it;
+        auto entry = _tiles.find(*it);
+        if (entry->second.tile.wait_for(std::chrono::seconds(0)) !=
+            std::future_status::ready) {
+            continue;
+        }
+        _memoryUsage -= entry->second.bytes;
+        _tiles.erase(entry);
+        it = _lru.erase(it);
+    }
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "forward.h"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <isce3/io/forward.h>
+
+/** Process-wide cache of DEM tiles shared by DEMInterpolator instances
+ *
+ * The DEM is divided into square tiles of fixed size that are read on first
+ * use and kept in memory, so that the overlapping subsets loaded by the
+ * blocks of an algorithm, by its threads, and by successive algorithms
+ * (e.g. topo, then geocode) only read each part of the file once. Tiles are
+ * evicted least recently used first when the memory budget is exceeded.
+ *
+ * Lookups are thread safe. A tile requested by several threads at once is
+ * read once, by the first of them, while the others wait for it.
+ *
+ * Tiles are identified by the file name, inode, modification time (to the
+ * nanosecond) and size of the DEM, so that a file rewritten in place is
+ * read again. Rasters that cannot be identified that way (MEM datasets,
+ * rasters opened for update) are read directly, as are all rasters when
+ * the budget is 0.
+ */
+class isce3::geometry::DEMTileCache {
+
+    public:
+        /** Constructor
+         *
+         * @param[in] memoryBudget Maximum memory held by the tiles (bytes)
+         * @param[in] tileSize     Width and length of the tiles (pixels) */
+        DEMTileCache(size_t memoryBudget = 256 * 1024 * 1024,
+                     int tileSize = 512);
+
+        DEMTileCache(const DEMTileCache &) = delete;
+        DEMTileCache & operator=(const DEMTileCache &) = delete;
+
+        /** Cache shared by the whole process */
+        static DEMTileCache & instance();
+
+        /** Memory budget getter (bytes) */
+        size_t memoryBudget() const;
+
+        /** Memory budget setter (bytes). Evicts tiles if needed; 0 disables
+         * caching. */
+        void memoryBudget(size_t budget);
+
+        /** Tile size getter (pixels) */
+        int tileSize() const { return _tileSize; }
+
+        /** Memory currently held by the tiles (bytes) */
+        size_t memoryUsage() const;
+
+        /** Number of tile lookups served from the cache */
+        size_t hits() const { return _hits; }
+
+        /** Number of tile lookups that read the file */
+        size_t misses() const { return _misses; }
+
+        /** Drop all tiles and reset the statistics. Must not be called
+         * while blocks are being read. */
+        void clear();
+
+        /** Read a block of the first band of a DEM raster through the cache */
+        void getBlock(isce3::io::Raster & demRaster, float * dem,
+                      int xstart, int ystart, int width, int length);
+
+        /** Read a block of the first band of a DEM raster through the cache */
+        void getBlock(isce3::io::ConcurrentRasterReader & demReader, float * dem,
+                      int xstart, int ystart, int width, int length);
+
+    private:
+        using Tile = std::shared_ptr<const std::vector<float>>;
+        using ReadFunction = std::function<void(float *, int, int, int, int)>;
+
+        // Source identifier, tile column, tile line
+        using Key = std::tuple<std::string, int, int>;
+
+        struct Entry {
+            std::shared_future<Tile> tile;
+            size_t bytes;
+            std::list<Key>::iterator lru;
+        };
+
+        // Copy a block from the tiles of a DEM of given dimensions, reading
+        // missing tiles with the given function
+        void _getBlock(const std::string & source, int demWidth, int demLength,
+                       const ReadFunction & read, float * dem,
+                       int xstart, int ystart, int width, int length);
+
+        // Tile of a DEM, read if needed
+        Tile _getTile(const std::string & source, int tileX, int tileY,
+                      int demWidth, int demLength, const ReadFunction & read);
+
+        // Evict least recently used tiles until the budget is met. Tiles
+        // still being read are kept. Must be called with the lock held.
+        void _evict();
+
+        size_t _memoryBudget;
+        int _tileSize;
+        size_t _memoryUsage = 0;
+        std::atomic<size_t> _hits {0};
+        std::atomic<size_t> _misses {0};
+
+        std::map<Key, Entry> _tiles;
+
+        // Keys from most to least recently used
+        std::list<Key> _lru;
+
+        mutable std::mutex _mutex;
+};
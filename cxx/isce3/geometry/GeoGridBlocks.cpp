@@ -0,0 +1,94 @@
+#include "GeoGridBlocks.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+#include <isce3/except/Error.h>
+
+// Index of a cell along the Hilbert curve filling an n x n grid, n a power
+// of 2
+static uint64_t hilbertIndex(uint64_t n, uint64_t x, uint64_t y) {
+    uint64_t d = 0;
+    for (uint64_t s = n / 2; s > 0; s /= 2) {
+        const uint64_t rx = (x & s) > 0;
+        const uint64_t ry = (y & s) > 0;
+        d += s * s * ((3 * rx) ^ ry);
+        // rotate the quadrant
+        if (ry == 0) {
+            if (rx == 1) {
+                x = n - 1 - x;
+                y = n - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+std::vector<isce3::geometry::GeoGridBlock>
+isce3::geometry::geoGridBlocks(int gridLength, int gridWidth,
+                               int linesPerBlock,
+                               geocodeBlockTraversal traversal) {
+
+    if (linesPerBlock < 1) {
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(),
+                "number of lines per block must be positive");
+    }
+
+    std::vector<GeoGridBlock> blocks;
+    if (gridLength <= 0 || gridWidth <= 0) {
+        return blocks;
+    }
+
+    if (traversal == BLOCKS_OF_LINES) {
+        for (int lineStart = 0; lineStart < gridLength;
+             lineStart += linesPerBlock) {
+            blocks.push_back({lineStart, 0,
+                              std::min(linesPerBlock, gridLength - lineStart),
+                              gridWidth});
+        }
+        return blocks;
+    }
+
+    if (traversal != HILBERT_TILES) {
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(),
+                "unknown geocoded grid block traversal");
+    }
+
+    // Square tiles of the pixels of a block of lines, within the grid
+    const double blockPixels = double(linesPerBlock) * gridWidth;
+    const int tileWidth = std::max(1, std::min(gridWidth,
+            static_cast<int>(std::round(std::sqrt(blockPixels)))));
+    const int tileLength = std::max(1, static_cast<int>(
+            std::min<double>(gridLength, blockPixels / tileWidth)));
+
+    const int ntilesX = (gridWidth + tileWidth - 1) / tileWidth;
+    const int ntilesY = (gridLength + tileLength - 1) / tileLength;
+    uint64_t n = 1;
+    while (n < uint64_t(std::max(ntilesX, ntilesY))) {
+        n *= 2;
+    }
+
+    std::vector<std::pair<uint64_t, GeoGridBlock>> tiles;
+    tiles.reserve(size_t(ntilesX) * ntilesY);
+    for (int tileY = 0; tileY < ntilesY; ++tileY) {
+        for (int tileX = 0; tileX < ntilesX; ++tileX) {
+            const int lineStart = tileY * tileLength;
+            const int pixelStart = tileX * tileWidth;
+            tiles.push_back({hilbertIndex(n, tileX, tileY),
+                             {lineStart, pixelStart,
+                              std::min(tileLength, gridLength - lineStart),
+                              std::min(tileWidth, gridWidth - pixelStart)}});
+        }
+    }
+    std::sort(tiles.begin(), tiles.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    blocks.reserve(tiles.size());
+    for (const auto& tile : tiles) {
+        blocks.push_back(tile.second);
+    }
+    return blocks;
+}
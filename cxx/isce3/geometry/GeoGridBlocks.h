@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+
+namespace isce3 { namespace geometry {
+
+/** Enumeration type to indicate the order in which the blocks of a geocoded
+ * grid are processed */
+enum geocodeBlockTraversal {
+    BLOCKS_OF_LINES = 0,
+    HILBERT_TILES = 1
+};
+
+/** Block of a geocoded grid */
+struct GeoGridBlock {
+    int lineStart;
+    int pixelStart;
+    int length;
+    int width;
+};
+
+/** Partition a geocoded grid into blocks
+ *
+ * With BLOCKS_OF_LINES, the blocks span the whole width of the grid and are
+ * ordered from the first line to the last. With HILBERT_TILES, the blocks
+ * are tiles as square as the grid allows, of the same number of pixels as
+ * blocks of linesPerBlock lines, ordered along a Hilbert curve. Consecutive
+ * tiles are then neighbors, and each tile maps to a compact region of the
+ * radar grid when the swath is rotated with respect to the geocoded grid
+ * (e.g. polar stereographic or high-latitude UTM grids).
+ *
+ * @param[in] gridLength    Number of lines of the grid
+ * @param[in] gridWidth     Number of pixels of the grid
+ * @param[in] linesPerBlock Number of full-width lines of a block
+ * @param[in] traversal     Shape and order of the blocks
+ * @returns Blocks covering the grid, in processing order
+ */
+std::vector<GeoGridBlock> geoGridBlocks(int gridLength, int gridWidth,
+        int linesPerBlock,
+        geocodeBlockTraversal traversal = BLOCKS_OF_LINES);
+
+}}
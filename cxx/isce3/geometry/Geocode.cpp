@@ -12,6 +12,10 @@
 #include <isce3/core/Basis.h>
 #include <isce3/core/DenseMatrix.h>
 #include <isce3/core/Projections.h>
+#include <isce3/io/ConcurrentRasterReader.h>
+#include <isce3/io/OverviewBuilder.h>
+#include <isce3/io/SlidingWindowCache.h>
+#include <isce3/product/GeoGridParameters.h>
 #include <isce3/geometry/boundingbox.h>
 #include <isce3/geometry/geometry.h>
 #include <isce3/signal/Looks.h>
@@ -62,6 +66,33 @@ void _accumulate(T_out& band_value, T a, double b) {
     band_value += a2 * b;
 }
 
+// Read a block of a band of the input raster of type T, converted to T_out
+template<typename T, typename T_out>
+void _getRadarBlock(isce3::io::Raster& inputRaster, T_out* rdrData,
+                    size_t xoff, size_t yoff, size_t width, size_t length,
+                    int band) {
+    if (inputRaster.dtype(band) == isce3::io::asGDT<T> &&
+        inputRaster.canMemmap(band)) {
+        // read directly from the memory-mapped input file
+        auto rdrMap = inputRaster.memmap<T>(band);
+        #pragma omp parallel for
+        for (size_t i = 0; i < length; ++i)
+            for (size_t j = 0; j < width; ++j)
+                _convertToOutputType(rdrMap(yoff + i, xoff + j),
+                                     rdrData[i * width + j]);
+    } else if ((std::is_same<T, std::complex<float>>::value ||
+                std::is_same<T, std::complex<double>>::value) &&
+               (std::is_same<T_out, float>::value ||
+                std::is_same<T_out, double>::value)) {
+        std::vector<T> rdrDataTemp(width * length);
+        inputRaster.getBlock(rdrDataTemp.data(), xoff, yoff, width, length,
+                             band);
+        for (size_t i = 0; i < width * length; ++i)
+            _convertToOutputType(rdrDataTemp[i], rdrData[i]);
+    } else
+        inputRaster.getBlock(rdrData, xoff, yoff, width, length, band);
+}
+
 template <typename T> struct is_complex_t : std::false_type {};
 template <typename T> struct is_complex_t<std::complex<T>> : std::true_type {};
 template <typename T>
@@ -127,6 +158,71 @@ void Geocode<T>::geoGrid(double geoGridStartX, double geoGridStartY,
     _epsgOut = epsgcode;
 }
 
+template<class T>
+BlockMemory Geocode<T>::blockMemory(
+        const isce3::product::RadarGridParameters& radar_grid,
+        isce3::io::Raster& input_raster, isce3::io::Raster& output_raster,
+        isce3::io::Raster& dem_raster) const {
+
+    // complex data geocoded to real outputs are converted from a temporary
+    // block of the input type
+    const bool complexToReal =
+            GDALDataTypeIsComplex(input_raster.dtype()) &&
+            !GDALDataTypeIsComplex(output_raster.dtype());
+    const size_t dataBytes = complexToReal ? sizeof(T) / 2 : sizeof(T);
+
+    // radar window of each band kept from one block to the next, plus the
+    // next window being assembled and the block read into it
+    const size_t radarBytes = (input_raster.numBands() + 1) * dataBytes +
+                              (complexToReal ? sizeof(T) : dataBytes);
+
+    // geocoded data, radar coordinates and DEM heights of the block
+    BlockMemory memory(_geoGridWidth *
+                       (dataBytes + 2 * sizeof(double) + sizeof(Vec3)));
+
+    // radar windows over the whole swath width, for the radar lines spanned
+    // by a line of the geocoded grid when it covers the radar grid along
+    // track
+    const double radarLinesPerLine =
+            static_cast<double>(radar_grid.length()) /
+            std::max(_geoGridLength, 1);
+    memory += BlockMemory(std::ceil(radarLinesPerLine * radar_grid.width() *
+                                    radarBytes));
+
+    const isce3::product::GeoGridParameters geoGrid(
+            _geoGridStartX, _geoGridStartY, _geoGridSpacingX, _geoGridSpacingY,
+            _geoGridWidth, _geoGridLength, _epsgOut);
+    memory += demBlockMemory(dem_raster, geoGrid, _demBlockMargin);
+    return memory;
+}
+
+template<class T>
+size_t Geocode<T>::_linesPerBlockFor(const BlockMemory& memory) const {
+    if (_memoryBudget > 0)
+        return memory.linesPerBlock(_memoryBudget, _geoGridLength);
+    return std::max<size_t>(std::min<size_t>(_linesPerBlock, _geoGridLength),
+                            1);
+}
+
+template<class T>
+size_t Geocode<T>::linesPerBlock(
+        const isce3::product::RadarGridParameters& radar_grid,
+        isce3::io::Raster& input_raster, isce3::io::Raster& output_raster,
+        isce3::io::Raster& dem_raster) const {
+    return _linesPerBlockFor(blockMemory(radar_grid, input_raster,
+                                         output_raster, dem_raster));
+}
+
+template<class T>
+size_t Geocode<T>::peakMemory(
+        const isce3::product::RadarGridParameters& radar_grid,
+        isce3::io::Raster& input_raster, isce3::io::Raster& output_raster,
+        isce3::io::Raster& dem_raster) const {
+    const BlockMemory memory = blockMemory(radar_grid, input_raster,
+                                           output_raster, dem_raster);
+    return memory.peak(_linesPerBlockFor(memory));
+}
+
 template<class T>
 void Geocode<T>::geocode(
         const isce3::product::RadarGridParameters& radar_grid,
@@ -207,6 +303,9 @@ void Geocode<T>::geocodeInterp(
     // number of bands in the input raster
     int nbands = inputRaster.numBands();
 
+    // read the radar blocks straight from the input file where possible
+    inputRaster.memmapBands();
+
     // create projection based on _epsg code
     std::unique_ptr<isce3::core::ProjectionBase> proj(
             isce3::core::createProj(_epsgOut));
@@ -214,24 +313,47 @@ void Geocode<T>::geocodeInterp(
     // instantiate the DEMInterpolator
     DEMInterpolator demInterp;
 
-    // Compute number of blocks in the output geocoded grid
-    int nBlocks = _geoGridLength / _linesPerBlock;
-    if ((_geoGridLength % _linesPerBlock) != 0)
-        nBlocks += 1;
+    // overviews of the output raster, filled as its blocks are written
+    std::unique_ptr<isce3::io::OverviewBuilder> overviews;
+    if (!_overviewFactors.empty())
+        overviews = std::make_unique<isce3::io::OverviewBuilder>(
+                outputRaster, _overviewFactors, _overviewResampling);
+
+    // Lines per block, from the memory budget if set
+    const BlockMemory memory = blockMemory(radar_grid, inputRaster,
+                                           outputRaster, demRaster);
+    const int linesPerBlock = _linesPerBlockFor(memory);
+    std::cout << "linesPerBlock: " << linesPerBlock << ", predicted peak memory: "
+              << _get_nbytes_str(memory.peak(linesPerBlock)) << std::endl;
+
+    // Blocks of the output geocoded grid, in processing order
+    const std::vector<GeoGridBlock> blocks = geoGridBlocks(
+            _geoGridLength, _geoGridWidth, linesPerBlock, _blockTraversal);
+    const int nBlocks = blocks.size();
+
+    // radar window of each band, sliding along the radar grid from one
+    // block to the next so that the lines shared by consecutive blocks are
+    // read once
+    std::vector<isce3::io::SlidingWindowCache<T_out>> rdrWindows;
+    rdrWindows.reserve(nbands);
+    for (int band = 0; band < nbands; ++band) {
+        rdrWindows.emplace_back([&inputRaster, band](T_out* rdrData,
+                size_t xoff, size_t yoff, size_t width, size_t length) {
+            _getRadarBlock<T>(inputRaster, rdrData, xoff, yoff, width, length,
+                              band + 1);
+        });
+    }
 
     std::cout << "nBlocks: " << nBlocks << std::endl;
     // loop over the blocks of the geocoded Grid
     for (int block = 0; block < nBlocks; ++block) {
         std::cout << "block: " << block << std::endl;
         // Get block extents (of the geocoded grid)
-        int lineStart, geoBlockLength;
-        lineStart = block * _linesPerBlock;
-        if (block == (nBlocks - 1)) {
-            geoBlockLength = _geoGridLength - lineStart;
-        } else {
-            geoBlockLength = _linesPerBlock;
-        }
-        int blockSize = geoBlockLength * _geoGridWidth;
+        const int lineStart = blocks[block].lineStart;
+        const int pixelStart = blocks[block].pixelStart;
+        const int geoBlockLength = blocks[block].length;
+        const int geoBlockWidth = blocks[block].width;
+        int blockSize = geoBlockLength * geoBlockWidth;
 
         // First and last line of the data block in radar coordinates
         size_t azimuthFirstLine = radar_grid.length() - 1;
@@ -243,13 +365,16 @@ void Geocode<T>::geocodeInterp(
 
         // load a block of DEM for the current geocoded grid
         _loadDEM(demRaster, demInterp, proj.get(), lineStart, geoBlockLength,
-                 _geoGridWidth, _demBlockMargin);
+                 geoBlockWidth, _demBlockMargin, pixelStart);
 
         // X and Y indices (in the radar coordinates) for the
         // geocoded pixels (after geo2rdr computation)
         std::valarray<double> radarX(blockSize);
         std::valarray<double> radarY(blockSize);
 
+        // Longitude, latitude and DEM height of the geocoded pixels
+        std::vector<Vec3> llhBlock(blockSize);
+
 #pragma omp parallel shared(azimuthFirstLine, rangeFirstPixel,                 \
                             azimuthLastLine, rangeLastPixel)
         {
@@ -259,28 +384,24 @@ void Geocode<T>::geocodeInterp(
             size_t localRangeFirstPixel = radar_grid.width() - 1;
             size_t localRangeLastPixel = 0;
 
+// Interpolate the DEM heights of the output grid a line at a time
+#pragma omp for
+            for (int blockLine = 0; blockLine < geoBlockLength; ++blockLine) {
+                _interpolateHeights(lineStart + blockLine, pixelStart,
+                                    geoBlockWidth, demInterp, proj.get(),
+                                    &llhBlock[blockLine * geoBlockWidth]);
+            }
+
 // Loop over lines, samples of the output grid
 #pragma omp for collapse(2)
             for (int blockLine = 0; blockLine < geoBlockLength; ++blockLine) {
-                for (int pixel = 0; pixel < _geoGridWidth; ++pixel) {
-
-                    // Global line index
-                    const int line = lineStart + blockLine;
-
-                    // y coordinate in the out put grid
-                    double y = _geoGridStartY + _geoGridSpacingY * (0.5 + line);
-
-                    // x in the output geocoded Grid
-                    double x =
-                            _geoGridStartX + _geoGridSpacingX * (0.5 + pixel);
-
-                    // Consistency check
+                for (int pixel = 0; pixel < geoBlockWidth; ++pixel) {
 
                     // compute the azimuth time and slant range for the
                     // x,y coordinates in the output grid
                     double aztime, srange;
-                    _geo2rdr(radar_grid, x, y, aztime, srange, demInterp,
-                             proj.get());
+                    _geo2rdr(radar_grid, llhBlock[blockLine * geoBlockWidth + pixel],
+                             aztime, srange);
 
                     if (std::isnan(aztime) || std::isnan(srange))
                         continue;
@@ -307,8 +428,8 @@ void Geocode<T>::geocodeInterp(
                             localRangeLastPixel, (size_t) std::ceil(rdrX) - 1);
 
                     // store the adjusted X and Y indices
-                    radarX[blockLine * _geoGridWidth + pixel] = rdrX;
-                    radarY[blockLine * _geoGridWidth + pixel] = rdrY;
+                    radarX[blockLine * geoBlockWidth + pixel] = rdrX;
+                    radarY[blockLine * geoBlockWidth + pixel] = rdrY;
 
                 } // end loop over pixels of output grid
             }     // end loops over lines of output grid
@@ -327,43 +448,38 @@ void Geocode<T>::geocodeInterp(
             rangeFirstPixel > rangeLastPixel)
             continue;
 
+        // pad the radar block of a tile so that the geocoded pixels mapped
+        // to its edges are within the support of the interpolator. Blocks of
+        // lines keep their tight bounding box.
+        if (_blockTraversal == HILBERT_TILES) {
+            const size_t margin = std::max(_radarBlockMargin, 0);
+            azimuthFirstLine -= std::min(azimuthFirstLine, margin);
+            rangeFirstPixel -= std::min(rangeFirstPixel, margin);
+            azimuthLastLine = std::min(azimuthLastLine + margin,
+                                       radar_grid.length() - 1);
+            rangeLastPixel = std::min(rangeLastPixel + margin,
+                                      radar_grid.width() - 1);
+        }
+
         // shape of the required block of data in the radar coordinates
         int rdrBlockLength = azimuthLastLine - azimuthFirstLine + 1;
         int rdrBlockWidth = rangeLastPixel - rangeFirstPixel + 1;
 
         // define the matrix based on the rasterbands data type
-        isce3::core::Matrix<T_out> rdrDataBlock(rdrBlockLength, rdrBlockWidth);
-        isce3::core::Matrix<T_out> geoDataBlock(geoBlockLength, _geoGridWidth);
+        isce3::core::Matrix<T_out> geoDataBlock(geoBlockLength, geoBlockWidth);
 
-        // fill both matrices with NaN
-        rdrDataBlock.fill(std::numeric_limits<T_out>::quiet_NaN());
+        // fill the output with NaN
         geoDataBlock.fill(std::numeric_limits<T_out>::quiet_NaN());
 
         //for each band in the input:
         for (int band = 0; band < nbands; ++band) {
             std::cout << "band: " << band << std::endl;
-            // get a block of data
+            // get a block of data, reading only the radar lines that were
+            // not in the block of the previous output block
             std::cout << "get data block " << std::endl;
-            if ((std::is_same<T, std::complex<float>>::value ||
-                 std::is_same<T, std::complex<double>>::value)
-                    &&(std::is_same<T_out, float>::value ||
-                       std::is_same<T_out, double>::value) ) {
-                isce3::core::Matrix<T> rdrDataBlockTemp(rdrBlockLength,
-                                                       rdrBlockWidth);
-                inputRaster.getBlock(rdrDataBlockTemp.data(), rangeFirstPixel,
-                                     azimuthFirstLine, rdrBlockWidth,
-                                     rdrBlockLength, band + 1);
-                for (int i = 0; i < rdrBlockLength; ++i)
-                    for (int j = 0; j < rdrBlockWidth; ++j) {
-                        T_out output_value;
-                        _convertToOutputType(rdrDataBlockTemp(i, j),
-                                             output_value);
-                        rdrDataBlock(i, j) = output_value;
-                    }
-            } else
-                inputRaster.getBlock(rdrDataBlock.data(), rangeFirstPixel,
-                                     azimuthFirstLine, rdrBlockWidth,
-                                     rdrBlockLength, band + 1);
+            isce3::core::Matrix<T_out> rdrDataBlock = rdrWindows[band].getBlock(
+                    rangeFirstPixel, azimuthFirstLine, rdrBlockWidth,
+                    rdrBlockLength);
 
             // interpolate the data in radar grid to the geocoded grid
             std::cout << "interpolate " << std::endl;
@@ -373,8 +489,12 @@ void Geocode<T>::geocodeInterp(
 
             // set output
             std::cout << "set output " << std::endl;
-            outputRaster.setBlock(geoDataBlock.data(), 0, lineStart,
-                                  _geoGridWidth, geoBlockLength, band + 1);
+            outputRaster.setBlock(geoDataBlock.data(), pixelStart, lineStart,
+                                  geoBlockWidth, geoBlockLength, band + 1);
+            if (overviews)
+                overviews->addBlock(geoDataBlock.data(), pixelStart,
+                                    lineStart, geoBlockWidth, geoBlockLength,
+                                    band + 1);
         }
         // set output block of data
     } // end loop over block of output grid
@@ -401,26 +521,42 @@ void Geocode<T>::_interpolate(isce3::core::Matrix<T_out>& rdrDataBlock,
                               int radarBlockWidth, int radarBlockLength,
                               int azimuthFirstLine, int rangeFirstPixel,
                               isce3::core::Interpolator<T_out>* _interp) {
-    auto length = geoDataBlock.length();
-    auto width = geoDataBlock.width();
+    const size_t npixels = geoDataBlock.length() * geoDataBlock.width();
+    T_out* geoData = geoDataBlock.data();
     double extraMargin = 4.0;
 
-#pragma omp parallel for
-    for (decltype(length) kk = 0; kk < length * width; ++kk) {
-
-        auto i = kk / width;
-        auto j = kk % width;
+    // pixels interpolated by a single call to the interpolator
+    const size_t chunkSize = 1024;
+    const size_t nchunks = (npixels + chunkSize - 1) / chunkSize;
 
-        // adjust the row and column indicies for the current block,
-        // i.e., moving the origin to the top-left of this radar block.
-        double rdrY = radarY[i * width + j] - azimuthFirstLine;
-        double rdrX = radarX[i * width + j] - rangeFirstPixel;
+#pragma omp parallel for
+    for (size_t chunk = 0; chunk < nchunks; ++chunk) {
+        const size_t start = chunk * chunkSize;
+        const size_t stop = std::min(start + chunkSize, npixels);
+
+        double rdrX[chunkSize], rdrY[chunkSize];
+        size_t index[chunkSize];
+        T_out values[chunkSize];
+        size_t nvalid = 0;
+        for (size_t kk = start; kk < stop; ++kk) {
+
+            // adjust the row and column indicies for the current block,
+            // i.e., moving the origin to the top-left of this radar block.
+            const double y = radarY[kk] - azimuthFirstLine;
+            const double x = radarX[kk] - rangeFirstPixel;
+
+            if (x < extraMargin || y < extraMargin ||
+                x >= (radarBlockWidth - extraMargin) ||
+                y >= (radarBlockLength - extraMargin))
+                continue;
+            rdrX[nvalid] = x;
+            rdrY[nvalid] = y;
+            index[nvalid++] = kk;
+        }
 
-        if (rdrX < extraMargin || rdrY < extraMargin ||
-            rdrX >= (radarBlockWidth - extraMargin) ||
-            rdrY >= (radarBlockLength - extraMargin))
-            continue;
-        geoDataBlock(i, j) = _interp->interpolate(rdrX, rdrY, rdrDataBlock);
+        _interp->interpolate(rdrX, rdrY, nvalid, rdrDataBlock, values);
+        for (size_t k = 0; k < nvalid; ++k)
+            geoData[index[k]] = values[k];
     }
 }
 
@@ -428,7 +564,8 @@ template<class T>
 void Geocode<T>::_loadDEM(isce3::io::Raster& demRaster,
                           DEMInterpolator& demInterp,
                           isce3::core::ProjectionBase* proj, int lineStart,
-                          int blockLength, int blockWidth, double demMargin) {
+                          int blockLength, int blockWidth, double demMargin,
+                          int pixelStart) {
     // Create projection for DEM
     int epsgcode = demRaster.getEPSG();
 
@@ -478,9 +615,12 @@ void Geocode<T>::_loadDEM(isce3::io::Raster& demRaster,
 
         // Loop over the indices
         for (int i = 0; i < lineInd.size(); ++i) {
-            Vec3 outpt = {_geoGridStartX + _geoGridSpacingX * (0.5 + pixInd[i]),
+            Vec3 outpt = {_geoGridStartX +
+                                  _geoGridSpacingX *
+                                          (0.5 + pixelStart + pixInd[i]),
                           _geoGridStartY +
-                                  _geoGridSpacingY * (0.5 + lineInd[i]),
+                                  _geoGridSpacingY *
+                                          (0.5 + lineStart + lineInd[i]),
                           0.0};
 
             Vec3 dempt;
@@ -498,8 +638,11 @@ void Geocode<T>::_loadDEM(isce3::io::Raster& demRaster,
                 _geoGridStartY + _geoGridSpacingY * (lineStart + blockLength);
         minY = std::min(Y1, Y2);
         maxY = std::max(Y1, Y2);
-        minX = _geoGridStartX;
-        maxX = _geoGridStartX + _geoGridSpacingX * (blockWidth);
+        double X1 = _geoGridStartX + _geoGridSpacingX * pixelStart;
+        double X2 =
+                _geoGridStartX + _geoGridSpacingX * (pixelStart + blockWidth);
+        minX = std::min(X1, X2);
+        maxX = std::max(X1, X2);
     }
 
     // If not LonLat, scale to meters
@@ -525,19 +668,34 @@ void Geocode<T>::_loadDEM(isce3::io::Raster& demRaster,
 }
 
 template<class T>
-void Geocode<T>::_geo2rdr(const isce3::product::RadarGridParameters& radar_grid,
-                          double x, double y, double& azimuthTime,
-                          double& slantRange, DEMInterpolator& demInterp,
-                          isce3::core::ProjectionBase* proj) {
-    // coordinate in the output projection system
-    const Vec3 xyz {x, y, 0.0};
-
-    // transform the xyz in the output projection system to llh
-    Vec3 llh = proj->inverse(xyz);
-
-    // interpolate the height from the DEM for this pixel
-    llh[2] = demInterp.interpolateLonLat(llh[0], llh[1]);
+void Geocode<T>::_interpolateHeights(int line, int pixelStart, int width,
+                                     DEMInterpolator& demInterp,
+                                     isce3::core::ProjectionBase* proj,
+                                     Vec3* llh) {
+    // y coordinate in the output grid
+    const double y = _geoGridStartY + _geoGridSpacingY * (0.5 + line);
+
+    // transform the xyz of the pixels in the output projection system to llh
+    std::vector<double> x(width), y_line(width, y), z(width, 0.0);
+    for (int pixel = 0; pixel < width; ++pixel) {
+        x[pixel] = _geoGridStartX +
+                   _geoGridSpacingX * (0.5 + pixelStart + pixel);
+    }
+    std::vector<double> lon(width), lat(width), height(width);
+    proj->inverse(x.data(), y_line.data(), z.data(), lon.data(), lat.data(),
+                  height.data(), width);
+
+    // interpolate the heights from the DEM for all the pixels at once
+    demInterp.interpolateLonLat(lon.data(), lat.data(), height.data(), width);
+    for (int pixel = 0; pixel < width; ++pixel) {
+        llh[pixel] = {lon[pixel], lat[pixel], height[pixel]};
+    }
+}
 
+template<class T>
+void Geocode<T>::_geo2rdr(const isce3::product::RadarGridParameters& radar_grid,
+                          const Vec3& llh, double& azimuthTime,
+                          double& slantRange) {
     // Perform geo->rdr iterations
     int geostat = geo2rdr(llh, _ellipsoid, _orbit, _doppler, azimuthTime,
                           slantRange, radar_grid.wavelength(),
@@ -793,17 +951,29 @@ void Geocode<T>::geocodeAreaProj(
 
     info << "starting geocoding" << pyre::journal::endl; 
 
+    // readers of the DEM and input rasters shared by the blocks, which
+    // load their data concurrently
+    isce3::io::ConcurrentRasterReader dem_reader(dem_raster);
+    isce3::io::ConcurrentRasterReader input_reader(input_raster);
+
+    // overviews of the output raster, filled as its blocks are written
+    std::unique_ptr<isce3::io::OverviewBuilder> output_overviews;
+    if (!_overviewFactors.empty())
+        output_overviews = std::make_unique<isce3::io::OverviewBuilder>(
+                output_raster, _overviewFactors, _overviewResampling);
+
     #pragma omp parallel for schedule(dynamic)
     for (int block = 0; block < nblocks; ++block) {
         _RunBlock<T_out>(radar_grid, is_radar_grid_single_block, rdrData, jmax,
                          block_size, block_size_with_upsampling, block, numdone,
                          progress_block, geogrid_upsampling, nbands,
-                         interp_method, dem_raster, 
+                         interp_method, dem_reader, 
                          out_geo_vertices,
                          out_dem_vertices,
                          out_geo_nlooks, out_geo_rtc, start,
                          pixazm, dr, r0, xbound, ybound, proj.get(), rtc_area,
-                         input_raster, output_raster, output_mode,
+                         input_reader, output_raster, output_overviews.get(),
+                         output_mode,
                          rtc_min_value, abs_cal_factor,
                          clip_min, clip_max, min_nlooks,
                          radar_grid_nlooks, info);
@@ -865,25 +1035,29 @@ void Geocode<T>::_GetRadarPositionVect(
         isce3::core::ProjectionBase* proj, DEMInterpolator& dem_interp_block,
         bool flag_direction_line) {
 
+    // DEM coordinates of the edge, interpolated all at once
+    const int n_points = std::max(k_end - k_start + 1, 0);
+    std::vector<double> dem_x(n_points), dem_y(n_points), dem_z(n_points);
     for (int kk = k_start; kk <= k_end; ++kk) {
         const int k = kk - k_start;
-
-        Vec3 dem11;
         if (flag_direction_line) {
             // flag_direction_line == true: y fixed, varies x
-            const double dem_pos_2 =
-                    _geoGridStartX + _geoGridSpacingX * kk / geogrid_upsampling;
-            // {x, y, z}
-            dem11 = {dem_pos_2, dem_pos_1,
-                     dem_interp_block.interpolateXY(dem_pos_2, dem_pos_1)};
+            dem_x[k] = _geoGridStartX + _geoGridSpacingX * kk / geogrid_upsampling;
+            dem_y[k] = dem_pos_1;
         } else {
             // flag_direction_line == false: x fixed, varies y
-            const double dem_pos_2 =
-                    _geoGridStartY + _geoGridSpacingY * kk / geogrid_upsampling;
-            // {x, y, z}
-            dem11 = {dem_pos_1, dem_pos_2,
-                     dem_interp_block.interpolateXY(dem_pos_1, dem_pos_2)};
+            dem_x[k] = dem_pos_1;
+            dem_y[k] = _geoGridStartY + _geoGridSpacingY * kk / geogrid_upsampling;
         }
+    }
+    dem_interp_block.interpolateXY(dem_x.data(), dem_y.data(), dem_z.data(),
+                                   n_points);
+
+    for (int kk = k_start; kk <= k_end; ++kk) {
+        const int k = kk - k_start;
+
+        // {x, y, z}
+        const Vec3 dem11 = {dem_x[k], dem_y[k], dem_z[k]};
         int converged =
                 geo2rdr(proj->inverse(dem11), _ellipsoid, _orbit, _doppler, a11,
                         r11, radar_grid.wavelength(), radar_grid.lookSide(),
@@ -936,12 +1110,15 @@ void Geocode<T>::_RunBlock(
         const int jmax, int block_size, int block_size_with_upsampling,
         int block, int& numdone, int progress_block, double geogrid_upsampling,
         int nbands, isce3::core::dataInterpMethod interp_method,
-        isce3::io::Raster& dem_raster, isce3::io::Raster* out_geo_vertices,
+        isce3::io::ConcurrentRasterReader& dem_reader,
+        isce3::io::Raster* out_geo_vertices,
         isce3::io::Raster* out_dem_vertices, isce3::io::Raster* out_geo_nlooks,
         isce3::io::Raster* out_geo_rtc, const double start, const double pixazm,
         const double dr, double r0, int xbound, int ybound,
         isce3::core::ProjectionBase* proj, isce3::core::Matrix<float>& rtc_area,
-        isce3::io::Raster& input_raster, isce3::io::Raster& output_raster,
+        isce3::io::ConcurrentRasterReader& input_reader,
+        isce3::io::Raster& output_raster,
+        isce3::io::OverviewBuilder* output_overviews,
         isce3::geometry::geocodeOutputMode output_mode,
         float rtc_min_value, double abs_cal_factor, float clip_min,
         float clip_max, float min_nlooks, float radar_grid_nlooks,
@@ -1015,12 +1192,9 @@ void Geocode<T>::_RunBlock(
     const double margin_x = std::abs(_geoGridSpacingX) * 10;
     const double margin_y = std::abs(_geoGridSpacingY) * 10;
 
-#pragma omp critical
-    {
-        dem_interp_block.loadDEM(dem_raster, minX - margin_x, maxX + margin_x,
-                                 std::min(minY, maxY) - margin_y,
-                                 std::max(minY, maxY) + margin_y);
-    }
+    dem_interp_block.loadDEM(dem_reader, minX - margin_x, maxX + margin_x,
+                             std::min(minY, maxY) - margin_y,
+                             std::max(minY, maxY) + margin_y);
 
     /*
     Example:
@@ -1182,8 +1356,7 @@ void Geocode<T>::_RunBlock(
                 info << "converting band to output dtype..." << pyre::journal::endl;
                 isce3::core::Matrix<T> radar_data_out( 
                     radar_grid_block.length(), radar_grid_block.width());
-                #pragma omp critical
-                input_raster.getBlock(radar_data_out.data(), offset_x,
+                input_reader.getBlock(radar_data_out.data(), offset_x,
                                       offset_y, radar_grid_block.width(),
                                       radar_grid_block.length(), band + 1);
                 for (int i = 0; i < radar_grid_block.length(); ++i)
@@ -1195,8 +1368,7 @@ void Geocode<T>::_RunBlock(
                                 radar_data_value;
                     }
             } else {
-                #pragma omp critical
-                input_raster.getBlock(rdrDataBlock[band].get()->data(),
+                input_reader.getBlock(rdrDataBlock[band].get()->data(),
                                       offset_x, offset_y,
                                       radar_grid_block.width(),
                                       radar_grid_block.length(), band + 1);
@@ -1537,11 +1709,17 @@ void Geocode<T>::_RunBlock(
                     geoDataBlock[band].get()->operator()(i, jj) =
                             std::numeric_limits<T_out>::quiet_NaN();
             }    
+        // the overviews are written to the dataset of the output raster,
+        // so under the same lock
         #pragma omp critical
         {
             output_raster.setBlock(geoDataBlock[band].get()->data(), 0,
                                    block * block_size, _geoGridWidth,
                                    this_block_size, band + 1);
+            if (output_overviews != nullptr)
+                output_overviews->addBlock(geoDataBlock[band].get()->data(), 0,
+                                           block * block_size, _geoGridWidth,
+                                           this_block_size, band + 1);
         }
     }
 
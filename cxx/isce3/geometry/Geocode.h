@@ -23,6 +23,8 @@
 #include <isce3/product/RadarGridParameters.h>
 
 // isce3::geometry
+#include <isce3/geometry/BlockMemory.h>
+#include <isce3/geometry/GeoGridBlocks.h>
 #include <isce3/geometry/RTC.h>
 
 #include "geometry.h"
@@ -242,6 +244,62 @@ public:
         _radarBlockMargin = radarBlockMargin;
     }
 
+    /** Set the shape and order of the blocks of the geocoded grid processed
+     * by the interpolation algorithm. HILBERT_TILES shrinks the radar blocks
+     * read for swaths rotated with respect to the geocoded grid. The radar
+     * block of each tile is padded by radarBlockMargin lines and pixels.
+     */
+    void blockTraversal(geocodeBlockTraversal traversal) {
+        _blockTraversal = traversal;
+    }
+
+    /** Set the memory budget of the interpolation algorithm (bytes). When
+     * non-zero, the number of lines per block is computed from the budget
+     * instead of linesPerBlock.
+     */
+    void memoryBudget(size_t memoryBudget) { _memoryBudget = memoryBudget; }
+
+    /** Memory footprint of the blocks of the interpolation algorithm: radar
+     * and geocoded data, radar coordinates and DEM heights of the geocoded
+     * pixels, and DEM.
+     *
+     * @param[in]  radar_grid          Radar grid
+     * @param[in]  input_raster        Input raster
+     * @param[in]  output_raster       Output raster
+     * @param[in]  dem_raster          Input DEM raster
+     */
+    BlockMemory blockMemory(const isce3::product::RadarGridParameters& radar_grid,
+                            isce3::io::Raster& input_raster,
+                            isce3::io::Raster& output_raster,
+                            isce3::io::Raster& dem_raster) const;
+
+    /** Number of lines per block of the interpolation algorithm, from the
+     * memory budget if set, or linesPerBlock
+     */
+    size_t linesPerBlock(const isce3::product::RadarGridParameters& radar_grid,
+                         isce3::io::Raster& input_raster,
+                         isce3::io::Raster& output_raster,
+                         isce3::io::Raster& dem_raster) const;
+
+    /** Predicted peak memory of the interpolation algorithm (bytes) */
+    size_t peakMemory(const isce3::product::RadarGridParameters& radar_grid,
+                      isce3::io::Raster& input_raster,
+                      isce3::io::Raster& output_raster,
+                      isce3::io::Raster& dem_raster) const;
+
+    /** Build decimated overview levels of the output raster from its
+     * blocks as they are written
+     * @param[in]  factors             Decimation factor of each overview
+     * level (empty to disable)
+     * @param[in]  resampling          Resampling method ("AVERAGE" or
+     * "NEAREST")
+     */
+    void overviews(const std::vector<int>& factors,
+                   const std::string& resampling = "AVERAGE") {
+        _overviewFactors = factors;
+        _overviewResampling = resampling;
+    }
+
     // start X position for the output geogrid
     double geoGridStartX() const { return _geoGridStartX; }
 
@@ -280,14 +338,17 @@ private:
               int block, int& numdone, int progress_block,
               double geogrid_upsampling, int nbands,
               isce3::core::dataInterpMethod interp_method,
-              isce3::io::Raster& dem_raster, isce3::io::Raster* out_geo_vertices,
+              isce3::io::ConcurrentRasterReader& dem_reader,
+              isce3::io::Raster* out_geo_vertices,
               isce3::io::Raster* out_dem_vertices,
               isce3::io::Raster* out_geo_nlooks, isce3::io::Raster* out_geo_rtc,
               const double start, const double pixazm, const double dr,
               double r0, int xbound, int ybound,
               isce3::core::ProjectionBase* proj,
               isce3::core::Matrix<float>& rtc_area,
-              isce3::io::Raster& input_raster, isce3::io::Raster& output_raster,
+              isce3::io::ConcurrentRasterReader& input_reader,
+              isce3::io::Raster& output_raster,
+              isce3::io::OverviewBuilder* output_overviews,
               isce3::geometry::geocodeOutputMode output_mode,
               float rtc_min_value, double abs_cal_factor, float clip_min,
               float clip_max, float min_nlooks, float radar_grid_nlooks,
@@ -295,13 +356,22 @@ private:
 
     void _loadDEM(isce3::io::Raster& demRaster, DEMInterpolator& demInterp,
                   isce3::core::ProjectionBase* _proj, int lineStart,
-                  int blockLength, int blockWidth, double demMargin);
+                  int blockLength, int blockWidth, double demMargin,
+                  int pixelStart = 0);
 
     std::string _get_nbytes_str(long nbytes);
 
+    // Lines per block of the interpolation algorithm for a footprint
+    size_t _linesPerBlockFor(const BlockMemory& memory) const;
+
+    // Interpolate the DEM heights of the pixels of a line of the geocoded
+    // grid
+    void _interpolateHeights(int line, int pixelStart, int width,
+                             DEMInterpolator& demInterp,
+                             isce3::core::ProjectionBase* proj, Vec3* llh);
+
     void _geo2rdr(const isce3::product::RadarGridParameters& radar_grid,
-                  double x, double y, double& azimuthTime, double& slantRange,
-                  DEMInterpolator& demInterp, isce3::core::ProjectionBase* proj);
+                  const Vec3& llh, double& azimuthTime, double& slantRange);
 
     template<class T_out>
     void
@@ -319,6 +389,7 @@ private:
     double _threshold;
     int _numiter;
     size_t _linesPerBlock = 1000;
+    size_t _memoryBudget = 0;
 
     // radar grids parameters
     isce3::core::LUT2d<double> _doppler;
@@ -348,12 +419,19 @@ private:
     double _demBlockMargin;
 
     // margin around the computed bounding box for radar dara (integer number of
-    // lines/pixels)
-    int _radarBlockMargin;
+    // lines/pixels), used by HILBERT_TILES
+    int _radarBlockMargin = 10;
+
+    // shape and order of the blocks of the geocoded grid
+    geocodeBlockTraversal _blockTraversal = BLOCKS_OF_LINES;
 
     // interpolator
     isce3::core::dataInterpMethod _interp_method =
             isce3::core::dataInterpMethod::BIQUINTIC_METHOD;
+
+    // decimation factors and resampling of the output raster overviews
+    std::vector<int> _overviewFactors;
+    std::string _overviewResampling = "AVERAGE";
 };
 
 std::vector<float> getGeoAreaElementMean(
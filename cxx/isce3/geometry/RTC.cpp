@@ -22,6 +22,7 @@
 #include <isce3/geometry/Geocode.h>
 #include <isce3/geometry/boundingbox.h>
 #include <isce3/geometry/geometry.h>
+#include <isce3/io/ConcurrentRasterReader.h>
 #include <isce3/product/RadarGridParameters.h>
 #include <isce3/signal/Looks.h>
 #include <string>
@@ -77,6 +78,10 @@ void _applyRTC(isce3::io::Raster& input_raster, isce3::io::Raster& input_rtc,
     if (std::isnan(rtc_min_value))
         rtc_min_value = 0;
 
+    // blocks are read concurrently
+    isce3::io::ConcurrentRasterReader input_reader(input_raster);
+    isce3::io::ConcurrentRasterReader input_rtc_reader(input_rtc);
+
     // for each band in the input:
     for (size_t band = 0; band < nbands; ++band) {
         info << "applying RTC to band: " << band + 1 << "/" << nbands
@@ -92,20 +97,14 @@ void _applyRTC(isce3::io::Raster& input_raster, isce3::io::Raster& input_rtc,
             }
 
             isce3::core::Matrix<float> rtc_ratio(effective_block_size, width);
-            #pragma omp critical
-            {
-                input_rtc.getBlock(rtc_ratio.data(), 0, block * block_size,
-                                   width, effective_block_size, 1);
-            }
+            input_rtc_reader.getBlock(rtc_ratio.data(), 0, block * block_size,
+                                      width, effective_block_size, 1);
 
             isce3::core::Matrix<T> radar_data_block(block_size, width);
             if (!flag_complex_to_real_squared) {
-                #pragma omp critical
-                {
-                    input_raster.getBlock(radar_data_block.data(), 0,
-                                          block * block_size, width,
-                                          effective_block_size, band + 1);
-                }
+                input_reader.getBlock(radar_data_block.data(), 0,
+                                      block * block_size, width,
+                                      effective_block_size, band + 1);
                 for (int i = 0; i < effective_block_size; ++i)
                     for (int jj = 0; jj < width; ++jj) {
                         float rtc_ratio_value = rtc_ratio(i, jj);
@@ -125,12 +124,9 @@ void _applyRTC(isce3::io::Raster& input_raster, isce3::io::Raster& input_rtc,
             } else {
                 isce3::core::Matrix<std::complex<T>> radar_data_block_complex(
                         block_size, width);
-                #pragma omp critical
-                {
-                    input_raster.getBlock(radar_data_block_complex.data(), 0,
-                                          block * block_size, width,
-                                          effective_block_size, band + 1);
-                }
+                input_reader.getBlock(radar_data_block_complex.data(), 0,
+                                      block * block_size, width,
+                                      effective_block_size, band + 1);
                 for (int i = 0; i < effective_block_size; ++i)
                     for (int jj = 0; jj < width; ++jj) {
                         float rtc_ratio_value = rtc_ratio(i, jj);
@@ -849,7 +845,8 @@ void _RunBlock(const int jmax, int block_size, int block_size_with_upsampling,
                int block, int& numdone, int progress_block,
                double geogrid_upsampling,
                isce3::core::dataInterpMethod interp_method,
-               isce3::io::Raster& dem_raster, isce3::io::Raster* out_geo_vertices,
+               isce3::io::ConcurrentRasterReader& dem_reader,
+               isce3::io::Raster* out_geo_vertices,
                isce3::io::Raster* out_geo_grid, const double start,
                const double pixazm, const double dr, double r0, int xbound,
                int ybound, const double y0, const double dy, const double x0,
@@ -907,12 +904,9 @@ void _RunBlock(const int jmax, int block_size, int block_size_with_upsampling,
     const double margin_x = std::abs(dx) * 20;
     const double margin_y = std::abs(dy) * 20;
 
-#pragma omp critical
-    {
-        dem_interp_block.loadDEM(dem_raster, minX - margin_x, maxX + margin_x,
-                                 std::min(minY, maxY) - margin_y,
-                                 std::max(minY, maxY) + margin_y);
-    }
+    dem_interp_block.loadDEM(dem_reader, minX - margin_x, maxX + margin_x,
+                             std::min(minY, maxY) - margin_y,
+                             std::max(minY, maxY) + margin_y);
 
     double a11 = radar_grid.sensingMid(), r11 = radar_grid.midRange();
     Vec3 dem11;
@@ -1326,10 +1320,13 @@ void facetRTCAreaProj(
     info << "block size (with upsampling): " << block_size_with_upsampling
          << pyre::journal::endl;
 
+    // DEM blocks are loaded concurrently
+    isce3::io::ConcurrentRasterReader dem_reader(dem_raster);
+
 #pragma omp parallel for schedule(dynamic)
     for (int block = 0; block < nblocks; ++block) {
         _RunBlock(jmax, block_size, block_size_with_upsampling, block, numdone,
-                  progress_block, geogrid_upsampling, interp_method, dem_raster,
+                  progress_block, geogrid_upsampling, interp_method, dem_reader,
                   out_geo_vertices, out_geo_grid, start, pixazm, dr, r0, xbound,
                   ybound, y0, dy, x0, dx, geogrid_length, geogrid_width,
                   radar_grid, input_dop, ellipsoid, orbit, threshold, num_iter,
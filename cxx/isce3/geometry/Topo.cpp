@@ -13,9 +13,14 @@
 #include <cstdlib>
 #include <fstream>
 #include <future>
+#include <memory>
 #include <valarray>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // isce3::core
 #include <isce3/core/Basis.h>
 #include <isce3/core/Constants.h>
@@ -28,6 +33,7 @@
 // isce3::geometry
 #include "DEMInterpolator.h"
 #include "TopoLayers.h"
+#include "boundingbox.h"
 
 // pull in some isce3::core namespaces
 using isce3::core::Basis;
@@ -36,6 +42,16 @@ using isce3::core::Pixel;
 using isce3::core::Vec3;
 using isce3::io::Raster;
 
+// Number of threads of the parallel regions
+static size_t _numThreads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
 isce3::geometry::Topo::
 Topo(const isce3::product::Product & product,
      char frequency,
@@ -140,9 +156,14 @@ topo(Raster & demRaster, TopoLayers & layers)
     // Create a DEM interpolator
     DEMInterpolator demInterp(-500.0, _demMethod);
 
+    // Lines per block, from the memory budget if set
+    const size_t linesPerBlock = _linesPerBlockFor(
+            _memoryBudget > 0 ? blockMemory(demRaster) : BlockMemory());
+    info << "Lines per block: " << linesPerBlock << pyre::journal::endl;
+
     // Compute number of blocks needed to process image
-    size_t nBlocks = _radarGrid.length() / _linesPerBlock;
-    if ((_radarGrid.length() % _linesPerBlock) != 0)
+    size_t nBlocks = _radarGrid.length() / linesPerBlock;
+    if ((_radarGrid.length() % linesPerBlock) != 0)
         nBlocks += 1;
 
     // Cache range bounds for diagnostics
@@ -156,11 +177,11 @@ topo(Raster & demRaster, TopoLayers & layers)
 
         // Get block extents
         size_t lineStart, blockLength;
-        lineStart = block * _linesPerBlock;
+        lineStart = block * linesPerBlock;
         if (block == (nBlocks - 1)) {
             blockLength = _radarGrid.length() - lineStart;
         } else {
-            blockLength = _linesPerBlock;
+            blockLength = linesPerBlock;
         }
 
         // Diagnostics
@@ -265,9 +286,13 @@ void isce3::geometry::Topo::topo(DEMInterpolator& demInterp,
     // Create and start a timer
     auto timerStart = std::chrono::steady_clock::now();
 
+    // Lines per block, from the memory budget if set
+    const size_t linesPerBlock = _linesPerBlockFor(blockMemory());
+    info << "Lines per block: " << linesPerBlock << pyre::journal::endl;
+
     // Compute number of blocks needed to process image
-    size_t nBlocks = _radarGrid.length() / _linesPerBlock;
-    if ((_radarGrid.length() % _linesPerBlock) != 0)
+    size_t nBlocks = _radarGrid.length() / linesPerBlock;
+    if ((_radarGrid.length() % linesPerBlock) != 0)
         nBlocks += 1;
 
     // Cache range bounds for diagnostics
@@ -281,11 +306,11 @@ void isce3::geometry::Topo::topo(DEMInterpolator& demInterp,
 
         // Get block extents
         size_t lineStart, blockLength;
-        lineStart = block * _linesPerBlock;
+        lineStart = block * linesPerBlock;
         if (block == (nBlocks - 1)) {
             blockLength = _radarGrid.length() - lineStart;
         } else {
-            blockLength = _linesPerBlock;
+            blockLength = linesPerBlock;
         }
 
         // Diagnostics
@@ -556,6 +581,57 @@ _initAzimuthLine(size_t line, double& tline, Vec3& pos, Vec3& vel, Basis& TCNbas
     TCNbasis = Basis(pos, vel);
 }
 
+isce3::geometry::BlockMemory isce3::geometry::Topo::
+blockMemory() const
+{
+    const size_t width = _radarGrid.width();
+
+    // Output layers: x, y, z and cross-track as double, inc, hdg, localInc,
+    // localPsi and sim as float, mask as short; satellite position per line
+    BlockMemory memory(width * (4 * sizeof(double) + 5 * sizeof(float) +
+                                sizeof(short)) + sizeof(Vec3));
+
+    // Layover/shadow work arrays copied to each thread, half of them on a
+    // grid oversampled by 2, and the shared slant ranges
+    if (_computeMask) {
+        const size_t threadBytes = width * (3 * sizeof(double) +
+                2 * (5 * sizeof(double) + sizeof(short)));
+        memory += BlockMemory(0, (_numThreads() + 1) * threadBytes +
+                                 width * sizeof(double));
+    }
+    return memory;
+}
+
+isce3::geometry::BlockMemory isce3::geometry::Topo::
+blockMemory(Raster & demRaster) const
+{
+    BlockMemory memory = blockMemory();
+
+    // DEM loaded for the blocks over the bounding box of the radar grid
+    std::unique_ptr<isce3::core::ProjectionBase> proj(
+            isce3::core::createProj(demRaster.getEPSG()));
+    const BoundingBox bbox = getGeoBoundingBox(_radarGrid, _orbit, proj.get(),
+                                               _doppler, {_minH, _maxH});
+    memory += demBlockMemory(demRaster, bbox.MinX, bbox.MaxX, bbox.MinY,
+                             bbox.MaxY, _margin, _radarGrid.length());
+    return memory;
+}
+
+size_t isce3::geometry::Topo::
+peakMemory(Raster & demRaster) const
+{
+    const BlockMemory memory = blockMemory(demRaster);
+    return memory.peak(_linesPerBlockFor(memory));
+}
+
+size_t isce3::geometry::Topo::
+_linesPerBlockFor(const BlockMemory & memory) const
+{
+    if (_memoryBudget > 0)
+        return memory.linesPerBlock(_memoryBudget, _radarGrid.length());
+    return std::max<size_t>(std::min(_linesPerBlock, _radarGrid.length()), 1);
+}
+
 // Get DEM bounds using first/last azimuth line and slant range bin
 void isce3::geometry::Topo::
 computeDEMBounds(Raster & demRaster, DEMInterpolator & demInterp, size_t lineOffset,
@@ -765,6 +841,7 @@ setLayoverShadow(TopoLayers& layers, DEMInterpolator& demInterp,
     // Allocate working valarrays
     std::valarray<double> x(width), y(width), ctrack(width), ctrackGrid(gridWidth);
     std::valarray<double> slantRange(width), slantRangeGrid(gridWidth);
+    std::valarray<double> xGrid(gridWidth), yGrid(gridWidth), zGrid(gridWidth);
     std::valarray<short> maskGrid(gridWidth);
 
     // Pre-compute slantRange grid used for all lines
@@ -777,7 +854,8 @@ setLayoverShadow(TopoLayers& layers, DEMInterpolator& demInterp,
 
     // Loop over lines in block
     #pragma omp parallel for firstprivate(x, y, ctrack, ctrackGrid, \
-                                          slantRangeGrid, maskGrid)
+                                          slantRangeGrid, maskGrid, \
+                                          xGrid, yGrid, zGrid)
     for (size_t line = 0; line < layers.length(); ++line) {
 
         // Cache satellite position for this line
@@ -798,7 +876,7 @@ setLayoverShadow(TopoLayers& layers, DEMInterpolator& demInterp,
         const double cmax = ctrack.max();// + demInterp.maxHeight();
         isce3::core::linspace<double>(cmin, cmax, ctrackGrid);
 
-        // Interpolate DEM to regular cross-track grid
+        // Interpolate DEM x/y coordinates to regular cross-track grid
         for (int i = 0; i < gridWidth; ++i) {
 
             // Compute nearest ctrack index for current ctrackGrid value
@@ -816,11 +894,18 @@ setLayoverShadow(TopoLayers& layers, DEMInterpolator& demInterp,
             const double c2 = ctrack[k+1];
             const double frac1 = (c2 - crossTrack) / (c2 - c1);
             const double frac2 = (crossTrack - c1) / (c2 - c1);
-            const double x_grid = x[k] * frac1 + x[k+1] * frac2;
-            const double y_grid = y[k] * frac1 + y[k+1] * frac2;
+            xGrid[i] = x[k] * frac1 + x[k+1] * frac2;
+            yGrid[i] = y[k] * frac1 + y[k+1] * frac2;
+        }
+
+        // Interpolate DEM at x/y for the whole grid
+        demInterp.interpolateXY(&xGrid[0], &yGrid[0], &zGrid[0], gridWidth);
+
+        for (int i = 0; i < gridWidth; ++i) {
 
-            // Interpolate DEM at x/y
-            const float z_grid = demInterp.interpolateXY(x_grid, y_grid);
+            const double x_grid = xGrid[i];
+            const double y_grid = yGrid[i];
+            const float z_grid = zGrid[i];
 
             // Convert DEM XYZ to ECEF XYZ
             Vec3 llh, xyz, satToGround;
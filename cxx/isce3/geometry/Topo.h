@@ -21,6 +21,7 @@
 #include <isce3/product/RadarGridParameters.h>
 
 // isce3::geometry
+#include "BlockMemory.h"
 #include "geometry.h"
 
 /**
@@ -149,6 +150,23 @@ public:
      */
     void decimaldegMargin(double deg) { _margin = deg; }
 
+    /**
+     * Set number of lines per block
+     *
+     * @param[in] lines Number of radar lines processed at a time
+     */
+    void linesPerBlock(size_t lines) { _linesPerBlock = lines; }
+
+    /**
+     * Set memory budget
+     *
+     * When non-zero, the number of lines per block is computed from the
+     * budget instead of the set number of lines per block.
+     *
+     * @param[in] bytes Memory budget of the blocks (bytes)
+     */
+    void memoryBudget(size_t bytes) { _memoryBudget = bytes; }
+
     // Get topo processing options
 
     /** Get lookSide used for processing */
@@ -181,6 +199,33 @@ public:
     /** Get margin in decimal degrees */
     double decimaldegMargin() const { return _margin; }
 
+    /** Get number of lines per block */
+    size_t linesPerBlock() const { return _linesPerBlock; }
+
+    /** Get memory budget (bytes) */
+    size_t memoryBudget() const { return _memoryBudget; }
+
+    /**
+     * Memory footprint of the blocks: output layers, satellite positions
+     * and layover/shadow work arrays, for a DEM already in memory
+     */
+    BlockMemory blockMemory() const;
+
+    /**
+     * Memory footprint of the blocks including the DEM blocks loaded from
+     * a DEM raster
+     *
+     * @param[in] demRaster input DEM raster
+     */
+    BlockMemory blockMemory(isce3::io::Raster & demRaster) const;
+
+    /**
+     * Predicted peak memory of topo with a DEM raster (bytes)
+     *
+     * @param[in] demRaster input DEM raster
+     */
+    size_t peakMemory(isce3::io::Raster & demRaster) const;
+
     /** Get read-only reference to RadarGridParameters */
     const isce3::product::RadarGridParameters & radarGridParameters() const { return _radarGrid; }
 
@@ -398,6 +443,10 @@ private:
     /** Main entry point for the module; internal creation of topo rasters */
     template<typename T> void _topo(T& dem, const std::string& outdir);
 
+    /** Number of lines per block for a memory footprint, from the memory
+     * budget if set, or the set number of lines per block */
+    size_t _linesPerBlockFor(const BlockMemory & memory) const;
+
     /** Run topo with externally created topo rasters; generate mask */
     template<typename T>
     void _topo(T& dem, isce3::io::Raster& xRaster, isce3::io::Raster& yRaster,
@@ -429,6 +478,7 @@ private:
     double _maxH = isce3::core::GLOBAL_MAX_HEIGHT;   //Highest altitude in scene (global maximum default)
     double _margin = 0.15;        //Margin for bounding box in decimal degrees
     size_t _linesPerBlock = 1000; //Block size for processing
+    size_t _memoryBudget = 0;     //Memory budget setting the block size (bytes)
     bool _computeMask = true;     //Flag for generating shadow-layover mask
 
     isce3::core::LookSide _lookSide;
@@ -2,7 +2,9 @@
 
 namespace isce3 { namespace geometry {
 
+    class BlockMemory;
     class DEMInterpolator;
+    class DEMTileCache;
     class Topo;
     class TopoLayers;
 
@@ -61,6 +61,10 @@ resamp(isce3::io::Raster & inputSlc, isce3::io::Raster & outputSlc,
         
     // Set the band number for input SLC
     _inputBand = inputBand;
+    // Read the SLC and offsets straight from their files where possible
+    inputSlc.memmapBands();
+    rgOffsetRaster.memmapBands();
+    azOffsetRaster.memmapBands();
     // Cache width of SLC image
     const int inLength = inputSlc.length();
     const int inWidth = inputSlc.width();
@@ -140,10 +144,10 @@ _initializeOffsetTiles(Tile_t & tile,
     rgOffTile.allocate();
 
     // Read in block of range and azimuth offsets 
-    azOffsetRaster.getBlock(&azOffTile[0], 0, azOffTile.rowStart(),
-                            azOffTile.width(), azOffTile.length());
-    rgOffsetRaster.getBlock(&rgOffTile[0], 0, rgOffTile.rowStart(),
-                            rgOffTile.width(), rgOffTile.length());
+    azOffsetRaster.getBlockMapped(&azOffTile[0], 0, azOffTile.rowStart(),
+                                  azOffTile.width(), azOffTile.length());
+    rgOffsetRaster.getBlockMapped(&rgOffTile[0], 0, rgOffTile.rowStart(),
+                                  rgOffTile.width(), rgOffTile.length());
 }
 
 // Initialize tile bounds
@@ -212,8 +216,8 @@ _initializeTile(Tile_t & tile, Raster & inputSlc, const isce3::image::Tile<float
     tile.allocate();
 
     // Read in tile.length() lines of data from the input image to the image block
-    inputSlc.getBlock(&tile[0], 0, tile.firstImageRow(), tile.width(),
-                      tile.length(), _inputBand);
+    inputSlc.getBlockMapped(&tile[0], 0, tile.firstImageRow(), tile.width(),
+                            tile.length(), _inputBand);
 
     // Remove carrier from input data
     for (int i = 0; i < tile.length(); i++) {
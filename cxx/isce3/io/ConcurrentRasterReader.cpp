@@ -0,0 +1,137 @@
+#include "ConcurrentRasterReader.h"
+
+#include <cstring>
+#include <isce3/except/Error.h>
+
+/**
+ * @param[in] raster Raster to read from
+ *
+ * Band datatypes, geotransform and memory maps are resolved here so that
+ * concurrent reads never touch the raster object.*/
+isce3::io::ConcurrentRasterReader::ConcurrentRasterReader(Raster & raster) :
+    _raster(raster),
+    _width(raster.width()),
+    _length(raster.length())
+{
+    _geoTransform = {0., 1., 0., 0., 0., 1.};
+    raster.dataset()->GetGeoTransform(_geoTransform.data());
+
+    raster.memmapBands();
+    for (size_t band = 1; band <= raster.numBands(); ++band) {
+        _dtypes.push_back(raster.dtype(band));
+        _mmaps.push_back(raster.canMemmap(band) ? raster.memmap(band) :
+                isce3::io::gdal::Buffer(static_cast<const void *>(nullptr),
+                                        _dtypes.back(), {0, 0}));
+    }
+
+    // Only read-only rasters backed by a file can be reopened; new handles
+    // would not see pending writes of a raster opened for update.
+    const char * driver = raster.dataset()->GetDriverName();
+    _filename = raster.dataset()->GetDescription();
+    if (raster.access() != GA_ReadOnly || _filename.empty() ||
+        (driver && std::strcmp(driver, "MEM") == 0)) {
+        return;
+    }
+
+    GDALDataset * dataset = static_cast<GDALDataset *>(
+            GDALOpen(_filename.c_str(), GA_ReadOnly));
+    if (dataset && dataset->GetRasterXSize() == raster.dataset()->GetRasterXSize() &&
+        dataset->GetRasterYSize() == raster.dataset()->GetRasterYSize() &&
+        size_t(dataset->GetRasterCount()) == raster.numBands()) {
+        _idle.push_back(dataset);
+        _reopen = true;
+    } else if (dataset) {
+        GDALClose(dataset);
+    }
+}
+
+isce3::io::ConcurrentRasterReader::~ConcurrentRasterReader() {
+    for (auto dataset : _idle) {
+        GDALClose(dataset);
+    }
+}
+
+/** @param[out] arr Array of 6 double precision numbers */
+void isce3::io::ConcurrentRasterReader::getGeoTransform(double * arr) const {
+    std::copy(_geoTransform.begin(), _geoTransform.end(), arr);
+}
+
+int isce3::io::ConcurrentRasterReader::getEPSG() {
+    std::call_once(_epsgFlag, [this]() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _epsg = _raster.getEPSG();
+    });
+    return _epsg;
+}
+
+GDALDataset * isce3::io::ConcurrentRasterReader::_acquire() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_idle.empty()) {
+            GDALDataset * dataset = _idle.back();
+            _idle.pop_back();
+            return dataset;
+        }
+    }
+
+    // open outside of the lock so other threads keep reading
+    GDALDataset * dataset = static_cast<GDALDataset *>(
+            GDALOpen(_filename.c_str(), GA_ReadOnly));
+    if (!dataset) {
+        throw isce3::except::GDALError(ISCE_SRCINFO(),
+                "failed to reopen raster '" + _filename + "'");
+    }
+    return dataset;
+}
+
+void isce3::io::ConcurrentRasterReader::_release(GDALDataset * dataset) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _idle.push_back(dataset);
+}
+
+void isce3::io::ConcurrentRasterReader::_copyMapped(void * buffer, size_t xidx, size_t yidx,
+                                                    size_t iowidth, size_t iolength,
+                                                    size_t band) const {
+    if (xidx + iowidth > _width || yidx + iolength > _length) {
+        throw isce3::except::OutOfRange(ISCE_SRCINFO(),
+                "block extends past the edge of the raster");
+    }
+
+    const isce3::io::gdal::Buffer & mmap = _mmaps[band - 1];
+    const size_t itemsize = mmap.itemsize();
+    const char * src = static_cast<const char *>(mmap.data()) +
+                       yidx * mmap.rowstride() + xidx * mmap.colstride();
+    char * dst = static_cast<char *>(buffer);
+    for (size_t i = 0; i < iolength; ++i) {
+        const char * row = src + i * mmap.rowstride();
+        char * out = dst + i * iowidth * itemsize;
+        if (mmap.colstride() == itemsize) {
+            std::memcpy(out, row, iowidth * itemsize);
+        } else {
+            for (size_t j = 0; j < iowidth; ++j) {
+                std::memcpy(out + j * itemsize, row + j * mmap.colstride(), itemsize);
+            }
+        }
+    }
+}
+
+void isce3::io::ConcurrentRasterReader::_readBlock(void * buffer, GDALDataType dtype,
+                                                   size_t xidx, size_t yidx,
+                                                   size_t iowidth, size_t iolength,
+                                                   size_t band) {
+    CPLErr status;
+    if (_reopen) {
+        GDALDataset * dataset = _acquire();
+        status = dataset->GetRasterBand(band)->RasterIO(GF_Read, xidx, yidx, iowidth,
+                iolength, buffer, iowidth, iolength, dtype, 0, 0);
+        _release(dataset);
+    } else {
+        std::lock_guard<std::mutex> lock(_mutex);
+        status = _raster.dataset()->GetRasterBand(band)->RasterIO(GF_Read, xidx, yidx,
+                iowidth, iolength, buffer, iowidth, iolength, dtype, 0, 0);
+    }
+
+    if (status != CE_None) {
+        throw isce3::except::GDALError(ISCE_SRCINFO(), "error while reading from raster");
+    }
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "forward.h"
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <gdal_priv.h>
+
+#include <isce3/core/forward.h>
+#include <isce3/io/gdal/Buffer.h>
+
+/** Thread-safe block reader for a legacy isce3::io::Raster
+ *
+ * A GDALDataset handle may not be used by several threads at once. Instead
+ * of serializing all reads through the raster's handle, each concurrent
+ * read borrows a private read-only handle to the same file from a pool.
+ * Handles are opened on demand and kept open for reuse, so the pool grows to
+ * the number of threads reading at the same time. The bands of the raster
+ * are mapped into virtual memory where possible (see Raster::memmapBands())
+ * when the reader is created, and copied from the mapping instead.
+ *
+ * Rasters that cannot be reopened by name (e.g. MEM datasets, or rasters
+ * opened for update whose pending writes would not be visible through a new
+ * handle) are read through the raster's own handle one thread at a time.
+ */
+class isce3::io::ConcurrentRasterReader {
+
+  public:
+
+      /** Constructor
+       *
+       * @param[in] raster Raster to read from. It must outlive the reader. */
+      explicit ConcurrentRasterReader(Raster & raster);
+
+      /** Destructor. Closes the pooled handles. */
+      ~ConcurrentRasterReader();
+
+      ConcurrentRasterReader(const ConcurrentRasterReader &) = delete;
+      ConcurrentRasterReader & operator=(const ConcurrentRasterReader &) = delete;
+
+      /** Width getter */
+      size_t width() const { return _width; }
+
+      /** Length getter */
+      size_t length() const { return _length; }
+
+      /** Number of bands getter */
+      size_t numBands() const { return _dtypes.size(); }
+
+      /** Return GDALDataType of specified band
+       *
+       * @param[in] band Band number in 1-index*/
+      GDALDataType dtype(const size_t band = 1) const { return _dtypes[band - 1]; }
+
+      /** Copy raster GeoTransform into a buffer of 6 elements */
+      void getGeoTransform(double * arr) const;
+
+      /** Return EPSG code corresponding to raster (looked up on first call) */
+      int getEPSG();
+
+      /** Name of the file (GDAL description) of the raster */
+      const std::string & filename() const { return _filename; }
+
+      /** Check whether reads through GDAL run concurrently (false if they
+       * are serialized through the raster's own handle) */
+      bool concurrent() const { return _reopen; }
+
+      /** Read block of data from given band to buffer. May be called from multiple threads. */
+      template<typename T> void getBlock(T * buffer, size_t xidx, size_t yidx,
+                                         size_t iowidth, size_t iolength, size_t band = 1);
+
+      /** Read block of data from given band to Matrix<T>. May be called from multiple threads. */
+      template<typename T> void getBlock(isce3::core::Matrix<T> & mat, size_t xidx, size_t yidx,
+                                         size_t band = 1);
+
+  private:
+
+      // Copy a block from the memory map of a band
+      void _copyMapped(void * buffer, size_t xidx, size_t yidx, size_t iowidth,
+                       size_t iolength, size_t band) const;
+
+      // Read block with datatype translation to dtype through a pooled
+      // handle (or the raster's handle if it cannot be reopened)
+      void _readBlock(void * buffer, GDALDataType dtype, size_t xidx, size_t yidx,
+                      size_t iowidth, size_t iolength, size_t band);
+
+      // Borrow a read-only handle from the pool, opening a new one if none
+      // is idle
+      GDALDataset * _acquire();
+
+      // Return a handle to the pool
+      void _release(GDALDataset * dataset);
+
+      Raster & _raster;
+      std::string _filename;
+      bool _reopen = false;
+      size_t _width;
+      size_t _length;
+      std::vector<GDALDataType> _dtypes;
+      // Memory maps of the bands (null data for bands that are not mapped)
+      std::vector<isce3::io::gdal::Buffer> _mmaps;
+      std::array<double, 6> _geoTransform;
+
+      int _epsg = 0;
+      std::once_flag _epsgFlag;
+
+      std::mutex _mutex;
+      std::vector<GDALDataset *> _idle;
+};
+
+#define ISCE_IO_CONCURRENTRASTERREADER_ICC
+#include "ConcurrentRasterReader.icc"
+#undef ISCE_IO_CONCURRENTRASTERREADER_ICC
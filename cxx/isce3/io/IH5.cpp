@@ -1,5 +1,6 @@
 #include "IH5.h"
 
+#include <algorithm>
 #include <isce3/core/Constants.h>
 
 ///////////////////////// UTILITIES ///////////////////////////////////
@@ -299,6 +300,130 @@ std::vector<int> isce3::io::IDataSet::getChunkSize() {
     return out;
 }
 
+/** Returns the size in bytes of one chunk of the dataset as stored in memory
+ * once decompressed, or 0 if the dataset is not chunked. */
+size_t isce3::io::IDataSet::getChunkBytes() {
+
+    const std::vector<int> chunkDims = getChunkSize();
+    if (chunkDims.empty() or chunkDims[0] == 0)
+        return 0;
+
+    size_t nbytes = getDataType().getSize();
+    for (int dim : chunkDims)
+        nbytes *= static_cast<size_t>(dim);
+    return nbytes;
+}
+
+/** Returns the number of hash table slots, the total size in bytes and the
+ * preemption policy of the raw-data chunk cache of the dataset. */
+isce3::io::ChunkCache isce3::io::IDataSet::getChunkCache() {
+    ChunkCache cache;
+    getAccessPlist().getChunkCache(cache.nslots, cache.nbytes, cache.w0);
+    return cache;
+}
+
+/** @param[in] memoryBudget  Maximum size in bytes of the chunk cache
+ *  @param[in] linesPerBlock Number of lines read at once by the caller
+ *                           (optional)
+ *
+ * The default HDF5 chunk cache (1 MB) is smaller than a single chunk of most
+ * SAR products, in which case every partial read of a compressed chunk
+ * decompresses it again. The returned settings size the cache to a whole
+ * number of chunks that fits the budget (at least one chunk, as a smaller
+ * cache is bypassed altogether). If linesPerBlock is given, the cache is
+ * further limited to the chunks touched by one block of lines, plus one row
+ * of chunks for blocks that are not chunk-aligned. The number of slots is a
+ * prime about 100 times the number of cached chunks, as recommended by the
+ * HDF5 documentation, and fully read chunks are evicted first. Contiguous
+ * datasets get the default settings. */
+isce3::io::ChunkCache
+isce3::io::IDataSet::getChunkCacheForBudget(size_t memoryBudget,
+                                            int linesPerBlock) {
+
+    ChunkCache cache;
+    const size_t chunkBytes = getChunkBytes();
+    if (chunkBytes == 0)
+        return cache;
+
+    size_t nchunks = std::max<size_t>(memoryBudget / chunkBytes, 1);
+
+    if (linesPerBlock > 0) {
+        const std::vector<int> dims = getDimensions();
+        const std::vector<int> chunkDims = getChunkSize();
+        const int rank = static_cast<int>(dims.size());
+        const int lineAxis = std::max(rank - 2, 0);
+
+        // Chunks across one row of chunks (single band for 3-D datasets)
+        size_t chunksPerRow = 1;
+        if (rank >= 2)
+            chunksPerRow = (dims[rank - 1] + chunkDims[rank - 1] - 1) /
+                           chunkDims[rank - 1];
+
+        const size_t chunkRows =
+                (linesPerBlock + chunkDims[lineAxis] - 1) /
+                        chunkDims[lineAxis] + 1;
+        nchunks = std::min(nchunks, chunksPerRow * chunkRows);
+    }
+
+    // Next prime above 100 times the number of chunks
+    size_t nslots = 100 * nchunks + 1;
+    auto isPrime = [](size_t n) {
+        for (size_t d = 2; d * d <= n; ++d)
+            if (n % d == 0)
+                return false;
+        return true;
+    };
+    while (not isPrime(nslots))
+        ++nslots;
+
+    cache.nslots = nslots;
+    cache.nbytes = nchunks * chunkBytes;
+    cache.w0 = 1.0;
+    return cache;
+}
+
+/** @param[in] linesPerBlock Desired number of lines per block
+ *
+ * Returns the largest multiple of the chunk length along the line axis (the
+ * second to last dimension) that does not exceed linesPerBlock, but at least
+ * one chunk length. Reading blocks of that length never decompresses the
+ * same chunk twice. Contiguous datasets return linesPerBlock unchanged. */
+int isce3::io::IDataSet::getChunkAlignedBlockLength(int linesPerBlock) {
+
+    if (linesPerBlock <= 0) {
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(),
+                "Number of lines per block must be positive");
+    }
+
+    const std::vector<int> chunkDims = getChunkSize();
+    if (chunkDims.empty() or chunkDims[0] == 0)
+        return linesPerBlock;
+
+    const int rank = static_cast<int>(chunkDims.size());
+    const int chunkLines = chunkDims[std::max(rank - 2, 0)];
+    return std::max(linesPerBlock / chunkLines, 1) * chunkLines;
+}
+
+/** @param[in] linesPerBlock Desired number of lines per block
+ *
+ * Returns the (first line, number of lines) pairs covering all the lines of
+ * the dataset with blocks of getChunkAlignedBlockLength(linesPerBlock) lines.
+ * Only the last block may be shorter. */
+std::vector<std::array<int, 2>>
+isce3::io::IDataSet::getChunkAlignedBlocks(int linesPerBlock) {
+
+    const int blockLength = getChunkAlignedBlockLength(linesPerBlock);
+
+    const std::vector<int> dims = getDimensions();
+    const int rank = static_cast<int>(dims.size());
+    const int length = (rank == 0) ? 1 : dims[std::max(rank - 2, 0)];
+
+    std::vector<std::array<int, 2>> blocks;
+    for (int line = 0; line < length; line += blockLength)
+        blocks.push_back({line, std::min(blockLength, length - line)});
+    return blocks;
+}
+
 /** @param[in] v Name of the attribute (optional).
  *  Returns the actual number of bit used to store the current dataset or given
  *  attribute data in the file. */
@@ -855,6 +980,17 @@ isce3::io::IDataSet isce3::io::IGroup::openDataSet(const H5std_string& name) {
     return H5::Group::openDataSet(name);
 }
 
+/** @param[in] name  Name of the dataset to open.
+ *  @param[in] cache Raw-data chunk cache settings of the dataset.
+ *
+ * The chunk cache of a dataset can only be set when it is opened. */
+isce3::io::IDataSet isce3::io::IGroup::openDataSet(const H5std_string& name,
+                                                   const ChunkCache& cache) {
+    H5::DSetAccPropList dapl;
+    dapl.setChunkCache(cache.nslots, cache.nbytes, cache.w0);
+    return H5::Group::openDataSet(name, dapl);
+}
+
 /** @param[in] name Name of the group to open.
  *
  * name must contain the full path from root location and name of the group
@@ -1014,6 +1150,17 @@ isce3::io::IDataSet isce3::io::IH5File::openDataSet(const H5std_string& name) {
     return H5::H5File::openDataSet(name);
 }
 
+/** @param[in] name  Name of the dataset to open.
+ *  @param[in] cache Raw-data chunk cache settings of the dataset.
+ *
+ * The chunk cache of a dataset can only be set when it is opened. */
+isce3::io::IDataSet isce3::io::IH5File::openDataSet(const H5std_string& name,
+                                                    const ChunkCache& cache) {
+    H5::DSetAccPropList dapl;
+    dapl.setChunkCache(cache.nslots, cache.nbytes, cache.w0);
+    return H5::H5File::openDataSet(name, dapl);
+}
+
 /** @param[in] name Name of the group to open.
  *
  * name must contain the full path from root location and name of the group
@@ -40,6 +40,18 @@ struct findMeta {
     std::string basePath;
 };
 
+/** Raw-data chunk cache settings of a dataset (see H5Pset_chunk_cache).
+ *
+ * Default values defer to the settings of the file access property list. */
+struct ChunkCache {
+    /** Number of slots in the cache hash table */
+    size_t nslots = H5D_CHUNK_CACHE_NSLOTS_DEFAULT;
+    /** Total size of the cache in bytes */
+    size_t nbytes = H5D_CHUNK_CACHE_NBYTES_DEFAULT;
+    /** Preemption policy in [0,1]. 1 evicts fully read/written chunks first */
+    double w0 = H5D_CHUNK_CACHE_W0_DEFAULT;
+};
+
 /** Our derived dataset structure that includes utility functions */
 class IDataSet : public H5::DataSet {
 
@@ -73,6 +85,23 @@ public:
     /** Get the storage chunk size of the dataset */
     std::vector<int> getChunkSize();
 
+    /** Get the number of bytes stored in one chunk of the dataset */
+    size_t getChunkBytes();
+
+    /** Get the raw-data chunk cache settings the dataset was opened with */
+    ChunkCache getChunkCache();
+
+    /** Get raw-data chunk cache settings fitting a memory budget */
+    ChunkCache getChunkCacheForBudget(size_t memoryBudget,
+                                      int linesPerBlock = 0);
+
+    /** Round a number of lines to a whole number of chunk rows */
+    int getChunkAlignedBlockLength(int linesPerBlock);
+
+    /** Split the dataset lines in chunk-aligned blocks of
+     * (first line, number of lines) */
+    std::vector<std::array<int, 2>> getChunkAlignedBlocks(int linesPerBlock);
+
     /** Get the number of bit used to store each dataset element */
     int getNumBits(const std::string& v = "");
 
@@ -363,6 +392,9 @@ public:
     /** Open a given dataset */
     IDataSet openDataSet(const H5std_string& name);
 
+    /** Open a given dataset with specific raw-data chunk cache settings */
+    IDataSet openDataSet(const H5std_string& name, const ChunkCache& cache);
+
     /** Open a given group */
     IGroup openGroup(const H5std_string& name);
 
@@ -478,6 +510,9 @@ public:
     /** Open a given dataset */
     IDataSet openDataSet(const H5std_string& name);
 
+    /** Open a given dataset with specific raw-data chunk cache settings */
+    IDataSet openDataSet(const H5std_string& name, const ChunkCache& cache);
+
     /** Open a given group */
     IGroup openGroup(const H5std_string& name);
 
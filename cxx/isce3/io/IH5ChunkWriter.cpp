@@ -0,0 +1,209 @@
+#include "IH5ChunkWriter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <zlib.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/** @param[in] dataset    2-D or 3-D (band, line, pixel) dataset to write
+ *  @param[in] numThreads Number of threads compressing chunks
+ *                        (0 for the OpenMP default) */
+isce3::io::IH5ChunkWriter::IH5ChunkWriter(const IDataSet& dataset,
+                                          int numThreads) :
+    _dataset(dataset), _direct(true), _numThreads(numThreads),
+    _deflateLevel(0) {
+
+    _rank = _dataset.getRank();
+    if (_rank != 2 and _rank != 3) {
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(),
+                "IH5ChunkWriter can only handle datasets of rank 2 or 3");
+    }
+    _lineAxis = _rank - 2;
+
+    if (_numThreads < 0) {
+        throw isce3::except::DomainError(ISCE_SRCINFO(),
+                "Number of threads must be non-negative");
+    }
+    if (_numThreads == 0) {
+#ifdef _OPENMP
+        _numThreads = omp_get_max_threads();
+#else
+        _numThreads = 1;
+#endif
+    }
+
+    for (int dim : _dataset.getDimensions())
+        _dims.push_back(static_cast<hsize_t>(dim));
+
+    _fileType = _dataset.getDataType();
+    _elemSize = _fileType.getSize();
+
+    // Contiguous datasets are written line by line through HDF5
+    H5::DSetCreatPropList plist = _dataset.getCreatePlist();
+    if (plist.getLayout() != H5D_CHUNKED) {
+        _chunkDims.assign(_rank, 1);
+        _direct = false;
+        return;
+    }
+
+    _chunkDims.resize(_rank);
+    plist.getChunk(_rank, _chunkDims.data());
+
+    // Chunks spanning several bands would need all bands at once
+    if (_rank == 3 and _chunkDims[0] != 1)
+        _direct = false;
+
+    // Only filters we can reproduce exactly are allowed
+    const int nfilters = plist.getNfilters();
+    for (int i = 0; i < nfilters; ++i) {
+        unsigned int flags = 0;
+        unsigned int filterConfig = 0;
+        size_t nelmts = 1;
+        unsigned int cdValues[1] = {0};
+        char name[64];
+        const H5Z_filter_t filter = plist.getFilter(i, flags, nelmts,
+                cdValues, sizeof(name), name, filterConfig);
+
+        if (filter == H5Z_FILTER_SHUFFLE) {
+            _filters.push_back(filter);
+        } else if (filter == H5Z_FILTER_DEFLATE) {
+            _filters.push_back(filter);
+            _deflateLevel = (nelmts > 0) ? static_cast<int>(cdValues[0]) : 6;
+        } else {
+            _direct = false;
+        }
+    }
+}
+
+/** Blocks written directly must start on a chunk boundary and end on a
+ * chunk boundary or at the last line of the dataset. */
+bool isce3::io::IH5ChunkWriter::_aligned(size_t firstLine,
+                                         size_t numLines) const {
+    const size_t chunkLines = _chunkDims[_lineAxis];
+    const size_t lastLine = firstLine + numLines;
+    return (firstLine % chunkLines == 0) and
+           (lastLine % chunkLines == 0 or lastLine == _dims[_lineAxis]);
+}
+
+void isce3::io::IH5ChunkWriter::_writeChunks(const void* buffer,
+                                             size_t firstLine,
+                                             size_t numLines, size_t band) {
+
+    const size_t width = _dims[_rank - 1];
+    const size_t chunkLines = _chunkDims[_lineAxis];
+    const size_t chunkWidth = _chunkDims[_rank - 1];
+    const size_t chunkElems = chunkLines * chunkWidth;
+    const size_t chunkBytes = chunkElems * _elemSize;
+
+    const size_t nChunkRows = (numLines + chunkLines - 1) / chunkLines;
+    const size_t nChunkCols = (width + chunkWidth - 1) / chunkWidth;
+    const long long nChunks = nChunkRows * nChunkCols;
+
+    const unsigned char* src = static_cast<const unsigned char*>(buffer);
+    const hid_t dsetId = _dataset.getId();
+
+    bool failed = false;
+    std::string message;
+
+    #pragma omp parallel num_threads(_numThreads)
+    {
+        // Per-thread work buffers, reused across chunks
+        std::vector<unsigned char> raw(chunkBytes);
+        std::vector<unsigned char> work(chunkBytes);
+        std::vector<unsigned char> packed(compressBound(chunkBytes));
+
+        #pragma omp for schedule(dynamic)
+        for (long long ichunk = 0; ichunk < nChunks; ++ichunk) {
+
+            const size_t row = ichunk / nChunkCols;
+            const size_t col = ichunk % nChunkCols;
+            const size_t rows = std::min(chunkLines,
+                                         numLines - row * chunkLines);
+            const size_t cols = std::min(chunkWidth,
+                                         width - col * chunkWidth);
+
+            // Gather the chunk, zero-padding edge chunks to full size
+            if (rows < chunkLines or cols < chunkWidth)
+                std::fill(raw.begin(), raw.end(), 0);
+            for (size_t i = 0; i < rows; ++i) {
+                const size_t offset =
+                        ((row * chunkLines + i) * width + col * chunkWidth) *
+                        _elemSize;
+                std::memcpy(&raw[i * chunkWidth * _elemSize], src + offset,
+                            cols * _elemSize);
+            }
+
+            // Run the filter pipeline
+            const unsigned char* data = raw.data();
+            size_t nbytes = chunkBytes;
+            bool ok = true;
+            for (H5Z_filter_t filter : _filters) {
+                if (filter == H5Z_FILTER_SHUFFLE and _elemSize > 1) {
+                    unsigned char* dst =
+                            (data == work.data()) ? raw.data() : work.data();
+                    for (size_t j = 0; j < _elemSize; ++j)
+                        for (size_t k = 0; k < chunkElems; ++k)
+                            dst[j * chunkElems + k] = data[k * _elemSize + j];
+                    data = dst;
+                } else if (filter == H5Z_FILTER_DEFLATE) {
+                    uLongf packedBytes = packed.size();
+                    ok = compress2(packed.data(), &packedBytes, data, nbytes,
+                                   _deflateLevel) == Z_OK;
+                    data = packed.data();
+                    nbytes = packedBytes;
+                }
+            }
+
+            // HDF5 itself is not thread-safe
+            hsize_t chunkOffset[3];
+            if (_rank == 3)
+                chunkOffset[0] = band - 1;
+            chunkOffset[_lineAxis] = firstLine + row * chunkLines;
+            chunkOffset[_lineAxis + 1] = col * chunkWidth;
+
+            #pragma omp critical(ih5chunkwriter_write)
+            {
+                if (not ok) {
+                    failed = true;
+                    message = "zlib failed to compress chunk";
+                } else if (H5Dwrite_chunk(dsetId, H5P_DEFAULT, 0, chunkOffset,
+                                          nbytes, data) < 0) {
+                    failed = true;
+                    message = "H5Dwrite_chunk failed";
+                }
+            }
+        }
+    }
+
+    if (failed)
+        throw isce3::except::RuntimeError(ISCE_SRCINFO(), message);
+}
+
+void isce3::io::IH5ChunkWriter::_writeBlock(const void* buffer,
+                                            const H5::DataType& memType,
+                                            size_t firstLine, size_t numLines,
+                                            size_t band) {
+
+    hsize_t start[3];
+    hsize_t count[3];
+    if (_rank == 3) {
+        start[0] = band - 1;
+        count[0] = 1;
+    }
+    start[_lineAxis] = firstLine;
+    count[_lineAxis] = numLines;
+    start[_lineAxis + 1] = 0;
+    count[_lineAxis + 1] = _dims[_rank - 1];
+
+    H5::DataSpace fspace = _dataset.getSpace();
+    fspace.selectHyperslab(H5S_SELECT_SET, count, start);
+
+    hsize_t memDims[2] = {count[_lineAxis], count[_lineAxis + 1]};
+    H5::DataSpace mspace(2, memDims);
+
+    _dataset.H5::DataSet::write(buffer, memType, mspace, fspace);
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "IH5.h"
+
+namespace isce3 {
+namespace io {
+
+/** Multi-threaded writer for chunked, compressed HDF5 datasets
+ *
+ * HDF5 runs the filter pipeline of a dataset on the calling thread, one
+ * chunk at a time, so writing a deflate-compressed product keeps a single
+ * core busy. This writer applies the shuffle and deflate filters of the
+ * dataset itself, compressing whole chunks in parallel, and stores the
+ * filtered chunks with H5Dwrite_chunk(). The chunks are byte-identical to
+ * what the HDF5 pipeline would produce, so the dataset stays readable by
+ * any HDF5 reader.
+ *
+ * Direct chunk writes are used when the dataset is chunked, its filters are
+ * limited to shuffle and deflate, each chunk holds a single band, and the
+ * block written starts on a chunk boundary and ends on a chunk boundary or
+ * at the last line. Anything else falls back to a regular (serial) write.
+ */
+class IH5ChunkWriter {
+
+public:
+    /** Constructor
+     *
+     * @param[in] dataset    2-D or 3-D (band, line, pixel) dataset to write
+     * @param[in] numThreads Number of threads compressing chunks
+     *                       (0 for the OpenMP default) */
+    explicit IH5ChunkWriter(const IDataSet& dataset, int numThreads = 0);
+
+    /** Check whether the dataset filters allow direct chunk writes */
+    bool direct() const { return _direct; }
+
+    /** Number of lines in a chunk (1 for contiguous datasets) */
+    size_t chunkLength() const { return _chunkDims[_lineAxis]; }
+
+    /** Number of threads compressing chunks */
+    int numThreads() const { return _numThreads; }
+
+    /** Write a block of full lines of the given band */
+    template<typename T>
+    void writeBlock(const T* buffer, size_t firstLine, size_t numLines,
+                    size_t band = 1);
+
+    /** Write a block of full lines from a std::vector */
+    template<typename T>
+    void writeBlock(const std::vector<T>& buffer, size_t firstLine,
+                    size_t band = 1);
+
+private:
+    // Check that a block can be written with direct chunk writes
+    bool _aligned(size_t firstLine, size_t numLines) const;
+
+    // Filter and write all the chunks covered by a block of elemSize-byte
+    // elements stored in the file datatype
+    void _writeChunks(const void* buffer, size_t firstLine, size_t numLines,
+                      size_t band);
+
+    // Write a block through the HDF5 pipeline with datatype conversion
+    void _writeBlock(const void* buffer, const H5::DataType& memType,
+                     size_t firstLine, size_t numLines, size_t band);
+
+    IDataSet _dataset;
+    H5::DataType _fileType;
+    int _rank;
+    int _lineAxis;
+    std::vector<hsize_t> _dims;
+    std::vector<hsize_t> _chunkDims;
+    size_t _elemSize;
+    bool _direct;
+    int _numThreads;
+
+    // Filter pipeline in application order (shuffle and/or deflate)
+    std::vector<H5Z_filter_t> _filters;
+    int _deflateLevel;
+};
+
+} // namespace io
+} // namespace isce3
+
+#define ISCE_IO_IH5CHUNKWRITER_ICC
+#include "IH5ChunkWriter.icc"
+#undef ISCE_IO_IH5CHUNKWRITER_ICC
@@ -0,0 +1,150 @@
+#include "OverviewBuilder.h"
+
+#include <algorithm>
+#include <cctype>
+#include <limits>
+#include <utility>
+#include <isce3/except/Error.h>
+
+/**
+ * @param[in] raster Raster opened for update
+ * @param[in] factors Decimation factor of each overview level (> 1)
+ * @param[in] resampling Resampling method ("AVERAGE" or "NEAREST")
+ *
+ * Overview levels missing from the dataset are created empty; levels that
+ * already exist with the same decimation are reused and overwritten.*/
+isce3::io::OverviewBuilder::OverviewBuilder(Raster & raster,
+                                            const std::vector<int> & factors,
+                                            const std::string & resampling) :
+    _raster(raster),
+    _width(raster.width()),
+    _length(raster.length()),
+    _factors(factors),
+    _resampling(resampling)
+{
+    std::transform(_resampling.begin(), _resampling.end(), _resampling.begin(),
+                   [](unsigned char c) { return std::toupper(c); });
+    if (_resampling != "AVERAGE" && _resampling != "NEAREST") {
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(),
+                "Unsupported overview resampling method: " + resampling);
+    }
+    _isAverage = (_resampling == "AVERAGE");
+
+    if (_factors.empty()) {
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(),
+                "At least one overview decimation factor is required");
+    }
+    for (int factor : _factors) {
+        if (factor < 2) {
+            throw isce3::except::InvalidArgument(ISCE_SRCINFO(),
+                    "Overview decimation factors must be greater than 1");
+        }
+    }
+    if (raster.access() != GA_Update) {
+        throw isce3::except::InvalidArgument(ISCE_SRCINFO(),
+                "Overviews can only be built for rasters opened for update");
+    }
+
+    // GDAL records no decimation factor for the overview levels: a level is
+    // identified by its dimensions, which are those of a single factor
+    auto ovSize = [this](int factor) {
+        return std::make_pair((_width + factor - 1) / factor,
+                              (_length + factor - 1) / factor);
+    };
+    for (size_t i = 0; i < _factors.size(); ++i) {
+        for (size_t j = 0; j < i; ++j) {
+            if (ovSize(_factors[i]) == ovSize(_factors[j])) {
+                throw isce3::except::InvalidArgument(ISCE_SRCINFO(),
+                        "Overview decimation factors " + std::to_string(_factors[j]) +
+                        " and " + std::to_string(_factors[i]) +
+                        " give overview levels of the same dimensions");
+            }
+        }
+    }
+
+    // Overview band of given band and factor, if it exists
+    GDALDataset * dataset = raster.dataset();
+    auto findOverview = [&](size_t band, int factor) -> GDALRasterBand * {
+        GDALRasterBand * rasterBand = dataset->GetRasterBand(band);
+        const auto size = ovSize(factor);
+        for (int i = 0; i < rasterBand->GetOverviewCount(); ++i) {
+            GDALRasterBand * overview = rasterBand->GetOverview(i);
+            if (overview && size_t(overview->GetXSize()) == size.first &&
+                size_t(overview->GetYSize()) == size.second) {
+                return overview;
+            }
+        }
+        return nullptr;
+    };
+
+    // Create the missing levels without computing them
+    std::vector<int> missing;
+    for (int factor : _factors) {
+        if (!findOverview(1, factor)) {
+            missing.push_back(factor);
+        }
+    }
+    if (!missing.empty()) {
+        const CPLErr status = dataset->BuildOverviews("NONE", missing.size(),
+                missing.data(), 0, nullptr, nullptr, nullptr);
+        if (status != CE_None) {
+            throw isce3::except::GDALError(ISCE_SRCINFO(),
+                    "Failed to create overview levels");
+        }
+    }
+
+    const size_t nbands = raster.numBands();
+    _overviews.resize(nbands);
+    _partial.resize(nbands);
+    for (size_t band = 1; band <= nbands; ++band) {
+        for (int factor : _factors) {
+            GDALRasterBand * overview = findOverview(band, factor);
+            if (!overview) {
+                throw isce3::except::GDALError(ISCE_SRCINFO(),
+                        "Overview level not found after creation");
+            }
+            _overviews[band - 1].push_back(overview);
+        }
+        _partial[band - 1].resize(_factors.size());
+    }
+}
+
+isce3::io::OverviewBuilder::~OverviewBuilder() {
+    try {
+        flush();
+    } catch (...) {
+    }
+}
+
+void isce3::io::OverviewBuilder::flush() {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (size_t band = 1; band <= _partial.size(); ++band) {
+        for (size_t level = 0; level < _factors.size(); ++level) {
+            const size_t ovWidth = (_width + _factors[level] - 1) / _factors[level];
+            auto & pending = _partial[band - 1][level];
+            for (const auto & item : pending) {
+                const Partial & partial = item.second;
+                const std::complex<double> value = partial.valid > 0 ?
+                        partial.sum / double(partial.valid) :
+                        std::complex<double>(nan, nan);
+                _write(band, level, &value, item.first % ovWidth,
+                       item.first / ovWidth, 1, 1);
+            }
+            pending.clear();
+        }
+    }
+}
+
+void isce3::io::OverviewBuilder::_write(size_t band, size_t level,
+                                        const std::complex<double> * buffer,
+                                        size_t xidx, size_t yidx,
+                                        size_t iowidth, size_t iolength) {
+    GDALRasterBand * overview = _overviews[band - 1][level];
+    const CPLErr status = overview->RasterIO(GF_Write, xidx, yidx, iowidth, iolength,
+            const_cast<std::complex<double> *>(buffer), iowidth, iolength,
+            GDT_CFloat64, 0, 0);
+    if (status != CE_None) {
+        throw isce3::except::GDALError(ISCE_SRCINFO(),
+                "Failed to write overview block");
+    }
+}
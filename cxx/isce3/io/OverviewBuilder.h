@@ -0,0 +1,117 @@
+#pragma once
+
+#include "forward.h"
+
+#include <complex>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <gdal_priv.h>
+
+#include <isce3/core/forward.h>
+
+/** Incremental overview (pyramid) generation for a legacy isce3::io::Raster
+ *
+ * Decimated overview levels are created in the raster's dataset (internal
+ * overviews for GeoTIFF, external .ovr files otherwise) and filled from the
+ * blocks of full-resolution data as they are written, so that the output
+ * does not have to be read again to build them.
+ *
+ * Each overview pixel covers factor x factor input pixels. With "AVERAGE"
+ * resampling it holds the mean of the valid (non-NaN) input pixels; input
+ * windows straddling several blocks are accumulated until all their pixels
+ * have been added. With "NEAREST" resampling it holds the input pixel at the
+ * center of its window.
+ *
+ * Blocks may be added in any order. The overviews are written to the dataset
+ * of the raster, which GDAL does not protect against concurrent access: the
+ * builder is not thread safe, and calls to addBlock and flush must be
+ * serialized by the caller with each other and with all other writes to the
+ * raster (e.g. in the same critical section as Raster::setBlock).
+ *
+ * GDAL records no decimation factor for overview levels, so they are
+ * identified by their dimensions. Factors giving levels of the same
+ * dimensions are rejected.
+ */
+class isce3::io::OverviewBuilder {
+
+  public:
+
+      /** Constructor
+       *
+       * @param[in] raster     Raster opened for update. It must outlive the
+       *                       builder.
+       * @param[in] factors    Decimation factor of each overview level
+       * @param[in] resampling Resampling method ("AVERAGE" or "NEAREST") */
+      OverviewBuilder(Raster & raster, const std::vector<int> & factors,
+                      const std::string & resampling = "AVERAGE");
+
+      /** Destructor. Writes overview pixels left incomplete. */
+      ~OverviewBuilder();
+
+      OverviewBuilder(const OverviewBuilder &) = delete;
+      OverviewBuilder & operator=(const OverviewBuilder &) = delete;
+
+      /** Decimation factors getter */
+      const std::vector<int> & factors() const { return _factors; }
+
+      /** Resampling method getter */
+      const std::string & resampling() const { return _resampling; }
+
+      /** Add a block of full-resolution data of the given band */
+      template<typename T> void addBlock(const T * buffer, size_t xidx, size_t yidx,
+                                         size_t iowidth, size_t iolength, size_t band = 1);
+
+      /** Add a block of full-resolution data from a Matrix<T> */
+      template<typename T> void addBlock(const isce3::core::Matrix<T> & mat, size_t xidx,
+                                         size_t yidx, size_t band = 1);
+
+      /** Write the overview pixels whose input windows were not completely
+       * added (e.g. if part of the raster was never written) */
+      void flush();
+
+  private:
+
+      // Running sum of the input pixels of an overview pixel
+      struct Partial {
+          std::complex<double> sum = 0;
+          size_t valid = 0;
+          size_t seen = 0;
+      };
+
+      // Average the input pixels of the overview pixels of a block at
+      // given level, accumulating the windows the block only partly covers
+      template<typename T>
+      void _addAverage(const T * buffer, size_t xidx, size_t yidx, size_t iowidth,
+                       size_t iolength, size_t band, size_t level);
+
+      // Sample the input pixels at the center of the overview pixels of a
+      // block at given level
+      template<typename T>
+      void _addNearest(const T * buffer, size_t xidx, size_t yidx, size_t iowidth,
+                       size_t iolength, size_t band, size_t level);
+
+      // Write a block of overview pixels (complex values are converted by
+      // GDAL to the datatype of real bands)
+      void _write(size_t band, size_t level, const std::complex<double> * buffer,
+                  size_t xidx, size_t yidx, size_t iowidth, size_t iolength);
+
+      Raster & _raster;
+      size_t _width;
+      size_t _length;
+      std::vector<int> _factors;
+      std::string _resampling;
+      bool _isAverage;
+
+      // Overview bands [band][level]
+      std::vector<std::vector<GDALRasterBand *>> _overviews;
+
+      // Incomplete overview pixels [band][level] indexed by
+      // line * overview width + pixel
+      std::vector<std::vector<std::unordered_map<size_t, Partial>>> _partial;
+};
+
+#define ISCE_IO_OVERVIEWBUILDER_ICC
+#include "OverviewBuilder.icc"
+#undef ISCE_IO_OVERVIEWBUILDER_ICC
@@ -230,9 +230,54 @@ int isce3::io::Raster::setEPSG(int epsgcode)
 
     return status;
 }
+// Virtual memory mappings of the bands of a raster, empty for the bands that
+// cannot be mapped
+class isce3::io::Raster::MemoryMaps {
+public:
+    std::vector<isce3::io::gdal::detail::MemoryMap> bands;
+};
+
+/**
+ * Only datasets opened read-only are mapped since GDAL may hold pending writes
+ * to the file in its block cache. Drivers that would emulate the mapping through
+ * RasterIO are not used.*/
+void isce3::io::Raster::memmapBands() {
+    if (_mmaps || access() != GA_ReadOnly)
+        return;
+
+    auto mmaps = std::make_shared<MemoryMaps>();
+    for (size_t band = 1; band <= numBands(); ++band)
+        mmaps->bands.push_back(
+                isce3::io::gdal::detail::MemoryMap::native(_dataset->GetRasterBand(band)));
+    _mmaps = mmaps;
+}
+
+/**
+ * @param[in] band Band index (1-based)*/
+bool isce3::io::Raster::canMemmap(size_t band) const {
+    return _mmaps && band >= 1 && band <= _mmaps->bands.size() &&
+           bool(_mmaps->bands[band - 1]);
+}
+
+/**
+ * @param[in] band Band index (1-based)
+ *
+ * Throws if the band was not mapped (see canMemmap())*/
+isce3::io::gdal::Buffer isce3::io::Raster::memmap(size_t band) const {
+    if (!canMemmap(band))
+        throw isce3::except::RuntimeError(ISCE_SRCINFO(), "Raster band is not memory mapped.");
+
+    const auto & mmap = _mmaps->bands[band - 1];
+    std::array<int, 2> shape = { int(length()), int(width()) };
+    std::array<std::size_t, 2> strides = { mmap.rowstride(), mmap.colstride() };
+    return isce3::io::gdal::Buffer(mmap.data(), dtype(band), shape, strides);
+}
+
 // Destructor. When GDALOpenShared() is used the dataset is dereferenced
 // and closed only if the referenced count is less than 1.
 isce3::io::Raster::~Raster() {
+    // release the memory maps before the dataset
+    _mmaps.reset();
     if (_owner) {
         GDALClose( _dataset );
     }
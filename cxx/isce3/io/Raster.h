@@ -13,7 +13,7 @@
 #include <cstdint>
 #include <string>
 #include <typeindex>
-#include <unordered_map>
+#include <memory>
 #include <vector>
 #include <valarray>
 #include <gdal_priv.h>
@@ -100,7 +100,7 @@ class isce3::io::Raster {
       /** GDALDataset pointer setter
        *
        * @param[in] ds GDALDataset pointer*/
-      inline void         dataset(GDALDataset* ds) { _dataset=ds; }
+      inline void         dataset(GDALDataset* ds) { _mmaps.reset(); _dataset=ds; }
 
       /** Return GDALDatatype of specified band
        *
@@ -165,6 +165,31 @@ class isce3::io::Raster {
       template<typename T> void    getBlock(pyre::grid::View<T>& view, size_t xidx, size_t yidx, size_t band = 1);
       template<typename T> void    setBlock(pyre::grid::View<T>& view, size_t xidx, size_t yidx, size_t band = 1);
 
+      //Zero-copy read access for raw raster formats
+      /** Map the bands of a read-only raster directly into virtual memory where the driver
+       * supports it (e.g. raw binary/ENVI or uncompressed GeoTIFF files). The mappings are
+       * released with the dataset; calling it again has no effect.
+       *
+       * Not thread safe: map the bands before sharing the raster between threads. */
+      void memmapBands();
+      /** Check whether a band was mapped into virtual memory by memmapBands()
+       *
+       * @param[in] band Band index (1-based)*/
+      bool canMemmap(size_t band = 1) const;
+      /** Get a read-only strided view of a band mapped into virtual memory. The mapping is
+       * valid during the lifetime of the raster object.
+       *
+       * @param[in] band Band index (1-based)*/
+      isce3::io::gdal::Buffer memmap(size_t band = 1) const;
+      /** Get a read-only strided view of a band mapped into virtual memory. The mapping is
+       * valid during the lifetime of the raster object.
+       *
+       * @param[in] band Band index (1-based)*/
+      template<typename T> isce3::io::gdal::TypedBuffer<T> memmap(size_t band = 1) const;
+      /** Read block of data from given band to buffer, copying directly from the memory map
+       * of the band if it was mapped with type T and through getBlock() otherwise */
+      template<typename T> void getBlockMapped(T* buffer, size_t xidx, size_t yidx, size_t iowidth, size_t iolength, size_t band = 1);
+
       //Functions to deal with projections and geotransform information
       /** Return EPSG code corresponding to raster*/
       int getEPSG();
@@ -191,6 +216,10 @@ class isce3::io::Raster {
 private:
     GDALDataset * _dataset;
     bool _owner = true;
+    // Virtual memory mappings of the bands created by memmapBands(), not
+    // shared with copies of the raster
+    class MemoryMaps;
+    std::shared_ptr<const MemoryMaps> _mmaps;
 };
 
 #define ISCE_IO_RASTER_ICC
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "forward.h"
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <isce3/core/forward.h>
+
+/** Sliding window over a band of a raster, keeping the pixels already read
+ *
+ * Algorithms processing an output grid in blocks read, for each block, the
+ * window of the input that it maps to. When consecutive windows overlap
+ * (e.g. the radar lines covered by consecutive blocks of a geocoded grid),
+ * the pixels of the previous window are kept and only the pixels outside
+ * of it are read.
+ *
+ * The pixels are read by a user function, so that they may be converted
+ * while read (e.g. from the data type of the raster). The cache is not
+ * thread safe.
+ */
+template<typename T>
+class isce3::io::SlidingWindowCache {
+
+  public:
+
+      /** Function reading a block of width x length pixels starting at
+       * pixel xoff and line yoff into a contiguous buffer */
+      using ReadFunction = std::function<void(T * block, size_t xoff,
+                                              size_t yoff, size_t width,
+                                              size_t length)>;
+
+      /** Constructor
+       *
+       * @param[in] read Function reading a block of the band */
+      explicit SlidingWindowCache(ReadFunction read) : _read(std::move(read)) {}
+
+      /** Window of the band, reading only the pixels outside of the
+       * previous window
+       *
+       * @param[in] xoff   Pixel index of the window (0-based)
+       * @param[in] yoff   Line index of the window (0-based)
+       * @param[in] width  Number of pixels in the window
+       * @param[in] length Number of lines in the window
+       * @returns View of the window, valid until the next call */
+      inline isce3::core::Matrix<T> getBlock(size_t xoff, size_t yoff,
+                                             size_t width, size_t length);
+
+      /** Drop the current window */
+      void clear() {
+          _data = std::vector<T>();
+          _width = _length = 0;
+      }
+
+      /** Number of pixels read since construction */
+      size_t pixelsRead() const { return _pixelsRead; }
+
+  private:
+
+      // Read a block into a window of given origin and width
+      inline void _readInto(std::vector<T> & window, size_t winX, size_t winY,
+                            size_t winWidth, size_t xoff, size_t yoff,
+                            size_t width, size_t length);
+
+      ReadFunction _read;
+
+      // Current window
+      std::vector<T> _data;
+      size_t _xoff = 0;
+      size_t _yoff = 0;
+      size_t _width = 0;
+      size_t _length = 0;
+
+      size_t _pixelsRead = 0;
+};
+
+#define ISCE_IO_SLIDINGWINDOWCACHE_ICC
+#include "SlidingWindowCache.icc"
+#undef ISCE_IO_SLIDINGWINDOWCACHE_ICC
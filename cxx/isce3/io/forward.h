@@ -2,5 +2,8 @@
 
 namespace isce3 { namespace io {
 
+    class ConcurrentRasterReader;
+    class OverviewBuilder;
     class Raster;
+    template<typename> class SlidingWindowCache;
 }}
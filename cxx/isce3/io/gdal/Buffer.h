@@ -229,6 +229,9 @@ public:
     constexpr
     GDALAccess access() const { return _access; }
 
+    /** Get the element at the specified row and column (no bounds checking) */
+    const T & operator()(std::size_t row, std::size_t col) const;
+
 private:
     T * _data;
     std::array<int, 2> _shape;
@@ -28,4 +28,23 @@ MemoryMap::MemoryMap(GDALRasterBand * raster, GDALAccess access)
     _rowstride = std::size_t(rowstride);
 }
 
+MemoryMap MemoryMap::native(const GDALRasterBand * raster)
+{
+    char ** options = CSLSetNameValue(nullptr, "USE_DEFAULT_IMPLEMENTATION", "NO");
+
+    int colstride;
+    GIntBig rowstride;
+    CPLVirtualMem * mmap = const_cast<GDALRasterBand *>(raster)->GetVirtualMemAuto(
+            GF_Read, &colstride, &rowstride, options);
+    CSLDestroy(options);
+
+    MemoryMap out;
+    if (mmap) {
+        out._mmap = std::shared_ptr<CPLVirtualMem>(mmap, [](CPLVirtualMem * mmap) { CPLVirtualMemFree(mmap); });
+        out._colstride = std::size_t(colstride);
+        out._rowstride = std::size_t(rowstride);
+    }
+    return out;
+}
+
 }}}}
@@ -5,6 +5,7 @@
 #include <memory>
 
 #include "../forward.h"
+#include "../../forward.h"
 
 namespace isce3 { namespace io { namespace gdal { namespace detail {
 
@@ -34,6 +35,7 @@ public:
     std::size_t rowstride() const { return _rowstride; }
 
     friend class isce3::io::gdal::Raster;
+    friend class isce3::io::Raster;
 
 private:
 
@@ -41,6 +43,11 @@ private:
 
     MemoryMap(GDALRasterBand * raster, GDALAccess access);
 
+    // Read-only mapping that is only created if the driver maps the file
+    // directly (e.g. raw binary/ENVI) rather than paging it in through
+    // RasterIO. Returns an empty map otherwise.
+    static MemoryMap native(const GDALRasterBand * raster);
+
     std::shared_ptr<CPLVirtualMem> _mmap;
     std::size_t _colstride = 0;
     std::size_t _rowstride = 0;
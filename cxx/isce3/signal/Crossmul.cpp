@@ -99,6 +99,11 @@ crossmul(isce3::io::Raster& referenceSLC,
     size_t ncols = referenceSLC.width();
     size_t nthreads = omp_thread_count();
 
+    // read the SLCs and offsets straight from their files where possible
+    referenceSLC.memmapBands();
+    secondarySLC.memmapBands();
+    rngOffsetRaster.memmapBands();
+
     //signal object for refSlc
     isce3::signal::Signal<float> refSignal(nthreads);
 
@@ -255,15 +260,26 @@ crossmul(isce3::io::Raster& referenceSLC,
 
         // get a block of reference and secondary SLC data
         // and a block of range offsets
-        // This will change once we have the functionality to 
-        // get a block of data directly in to a slice
-        std::valarray<std::complex<float>> dataLine(ncols);
-        for (size_t line = 0; line < blockRowsData; ++line){
-            referenceSLC.getLine(dataLine, rowStart + line);
-            refSlc[std::slice(line*fft_size, ncols, 1)] = dataLine;
-            secondarySLC.getLine(dataLine, rowStart + line);
-            secSlc[std::slice(line*fft_size, ncols, 1)] = dataLine;
-        }
+        // SLCs that can be memory mapped are copied straight into the
+        // zero-padded lines of the FFT buffers
+        auto readSlcBlock = [&](isce3::io::Raster & slcRaster,
+                                std::valarray<std::complex<float>> & slc) {
+            if (slcRaster.dtype() == GDT_CFloat32 && slcRaster.canMemmap()) {
+                const auto view = slcRaster.memmap<std::complex<float>>();
+                #pragma omp parallel for
+                for (size_t line = 0; line < blockRowsData; ++line)
+                    for (size_t col = 0; col < ncols; ++col)
+                        slc[line*fft_size + col] = view(rowStart + line, col);
+                return;
+            }
+            std::valarray<std::complex<float>> dataLine(ncols);
+            for (size_t line = 0; line < blockRowsData; ++line){
+                slcRaster.getLine(dataLine, rowStart + line);
+                slc[std::slice(line*fft_size, ncols, 1)] = dataLine;
+            }
+        };
+        readSlcBlock(referenceSLC, refSlc);
+        readSlcBlock(secondarySLC, secSlc);
         //referenceSLC.getBlock(refSlc, 0, rowStart, ncols, blockRowsData);
         //secondarySLC.getBlock(secSlc, 0, rowStart, ncols, blockRowsData);
    
@@ -281,11 +297,8 @@ crossmul(isce3::io::Raster& referenceSLC,
             std::cout << " - wavelength: " << _wavelength << std::endl;
 
             // Read range offsets
-            std::valarray<double> offsetLine(ncols);
-            for (size_t line = 0; line < blockRowsData; ++line){
-                rngOffsetRaster.getLine(offsetLine, rowStart + line);
-                rngOffset[std::slice(line*ncols, ncols, 1)] = offsetLine;
-            }
+            rngOffsetRaster.getBlockMapped(&rngOffset[0], 0, rowStart, ncols,
+                                           blockRowsData);
 
             #pragma omp parallel for
             for (size_t line = 0; line < blockRowsData; ++line){
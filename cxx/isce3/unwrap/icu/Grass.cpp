@@ -1,9 +1,9 @@
 #include <algorithm> // std::min
 #include <cmath> // round
-#include <cstdint> // uint8_t, UINT8_MAX
 #include <exception> // std::out_of_range, std::runtime_error
+#include <limits> // std::numeric_limits
 
-#include "ICU.h" // ICU, LabelMap, idx2_t, offset2_t
+#include "ICU.h" // ICU, LabelMap, label_t, idx2_t, offset2_t
 
 namespace isce3::unwrap::icu
 {
@@ -123,7 +123,7 @@ BootstrapStatus_t estimBootstrapPhase(
     const float * unw,
     const bool * currcc,
     const float * bsunw,
-    const uint8_t * bsccl,
+    const label_t * bsccl,
     const size_t width,
     const size_t numBsLines,
     const size_t minBsPts,
@@ -171,16 +171,16 @@ BootstrapStatus_t estimBootstrapPhase(
     return status;
 }
 
-uint8_t bootstrapLabel(
+label_t bootstrapLabel(
     LabelMap & labelmap,
     const bool * currcc,
-    const uint8_t * bsccl, 
+    const label_t * bsccl, 
     const size_t width, 
     const size_t numBsLines)
 {
     // Get the min label among connected components in the bootstrap overlap 
     // region.
-    uint8_t minlabel = UINT8_MAX;
+    label_t minlabel = std::numeric_limits<label_t>::max();
     const size_t bssize = numBsLines * width;
     for (size_t i = 0; i < bssize; ++i)
     {
@@ -196,7 +196,7 @@ uint8_t bootstrapLabel(
     {
         if (currcc[i] && bsccl[i] != 0)
         {
-            uint8_t oldlabel = labelmap.getlabel(bsccl[i]);
+            label_t oldlabel = labelmap.getlabel(bsccl[i]);
             if (oldlabel != minlabel)
             {
                 labelmap.setlabel(oldlabel, minlabel);
@@ -210,10 +210,10 @@ uint8_t bootstrapLabel(
 template<bool DO_BOOTSTRAP>
 void ICU::growGrass(
     float * unw,
-    uint8_t * ccl,
+    label_t * ccl,
     bool * currcc,
     float * bsunw,
-    uint8_t * bsccl, 
+    label_t * bsccl, 
     LabelMap & labelmap,
     const float * phase, 
     const bool * tree, 
@@ -281,7 +281,7 @@ void ICU::growGrass(
                         // bootstrap overlap region. 
                         // (If there was overlap with multiple connected 
                         // components, their labels will be merged later.)
-                        uint8_t bslabel = bootstrapLabel(
+                        label_t bslabel = bootstrapLabel(
                             labelmap, &currcc[bsoff], bsccl, width, _NumBsLines);
 
                         // Apply bootstrap phase and label.
@@ -300,7 +300,7 @@ void ICU::growGrass(
                         // No overlap/insufficient overlap in bootstrap region.
                         // Don't apply phase bootstrapping. Assign connected 
                         // component a new unique label.
-                        uint8_t newlabel = labelmap.nextlabel();
+                        label_t newlabel = labelmap.nextlabel();
                         for (size_t i = 0; i < tilesize; ++i)
                         {
                             if (currcc[i]) { ccl[i] = newlabel; }
@@ -330,7 +330,7 @@ void ICU::growGrass(
             {
                 // Don't apply phase bootstrapping. Assign connected component 
                 // a new unique label.
-                uint8_t newlabel = labelmap.nextlabel();
+                label_t newlabel = labelmap.nextlabel();
                 for (size_t i = 0; i < tilesize; ++i)
                 {
                     if (currcc[i]) { ccl[i] = newlabel; }
@@ -346,12 +346,12 @@ void ICU::growGrass(
 
 // Explicit template instantiation
 template void ICU::growGrass<true>(
-    float * unw, uint8_t * ccl, bool * currcc, float * bsunw, uint8_t * bsccl, 
+    float * unw, label_t * ccl, bool * currcc, float * bsunw, label_t * bsccl, 
     LabelMap & labelmap, const float * phase, const bool * tree, 
     const float * corr, float corrthr, const size_t length, const size_t width);
 
 template void ICU::growGrass<false>(
-    float * unw, uint8_t * ccl, bool * currcc, float * bsunw, uint8_t * bsccl, 
+    float * unw, label_t * ccl, bool * currcc, float * bsunw, label_t * bsccl, 
     LabelMap & labelmap, const float * phase, const bool * tree, 
     const float * corr, float corrthr, const size_t length, const size_t width);
 
@@ -3,11 +3,10 @@
 #include <array> // std::array
 #include <complex> // std::complex
 #include <cstddef> // size_t
-#include <cstdint> // uint8_t
 
 #include <isce3/io/Raster.h> // isce3::io::Raster
 
-#include "LabelMap.h" // LabelMap
+#include "LabelMap.h" // LabelMap, label_t
 
 namespace isce3::unwrap::icu
 {
@@ -117,11 +116,22 @@ public:
     /** Set bootstrap phase variance threshold (default: 8.0). */
     void bsPhaseVarThr(const float);
 
+    /** Get parallel tile processing flag. */
+    bool useParallelTiles() const;
+    /** 
+     * Set parallel tile processing flag (default: false). If true, tiles are 
+     * unwrapped independently in parallel and then stitched together using 
+     * their overlap.
+     */
+    void useParallelTiles(const bool);
+
     /** 
      * \brief Unwrap the target interferogram.
      *
      * @param[out] unw Unwrapped phase
-     * @param[out] ccl Connected component labels
+     * @param[out] ccl Connected component labels. Labels are 8-bit (max 255 
+     * components) unless the raster has a 16- or 32-bit integer type, in 
+     * which case up to the max value of that type are available.
      * @param[in] intf Interferogram
      * @param[in] corr Correlation
      * @param[in] seed Random state seed (default: 0)
@@ -161,10 +171,10 @@ public:
     template<bool DO_BOOTSTRAP>
     void growGrass(
         float * unw,
-        uint8_t * ccl,
+        label_t * ccl,
         bool * currcc,
         float * bsunw,
-        uint8_t * bsccl, 
+        label_t * bsccl, 
         LabelMap & labelmap,
         const float * phase, 
         const bool * tree, 
@@ -174,6 +184,15 @@ public:
         const size_t width);
 
 private:
+    // Unwrap tiles independently in parallel, then reconcile phase offsets 
+    // and connected component labels across tile overlaps.
+    void unwrapParallelTiles(
+        isce3::io::Raster & unw,
+        isce3::io::Raster & ccl,
+        isce3::io::Raster & intf,
+        isce3::io::Raster & corr,
+        unsigned int seed);
+
     // Configuration params
     size_t _NumBufLines = 3700;
     size_t _NumOverlapLines = 200;
@@ -193,6 +212,7 @@ private:
     size_t _NumBsLines = 16;
     size_t _MinBsPts = 16;
     float _BsPhaseVarThr = 8.f;
+    bool _UseParallelTiles = false;
 };
 
 }
@@ -1,33 +1,50 @@
 #pragma once
 
 #include <cstddef> // size_t
-#include <cstdint> // uint8_t
+#include <cstdint> // uint8_t, uint32_t, UINT8_MAX
 #include <vector> // std::vector
 
 namespace isce3::unwrap::icu
 {
 
+// Connected component label type
+typedef uint32_t label_t;
+
 // \brief Table of connected component label equivalences
 //
 // Maintains a list of all connected component labels along with a mapping 
-// to their minimum equivalent label.
+// to their minimum equivalent label. Equivalences are stored as a disjoint-set 
+// forest (union by rank with path compression) so that merging and looking up 
+// labels is nearly constant time regardless of the number of labels.
 class LabelMap
 {
 public:
-    // Constructor
-    LabelMap();
+    // Constructor (valid labels are 1 through maxlabel)
+    LabelMap(const label_t maxlabel = UINT8_MAX);
     // Add new label to table and return the label.
-    uint8_t nextlabel();
+    label_t nextlabel();
     // Get mapped label.
-    uint8_t getlabel(const uint8_t) const;
-    // Update a label mapping.
-    void setlabel(const uint8_t oldlabel, const uint8_t newlabel);
+    label_t getlabel(const label_t) const;
+    // Merge two labels. Both are mapped to the min of their mapped labels.
+    void setlabel(const label_t oldlabel, const label_t newlabel);
     // Get number of labels.
     size_t size() const;
+    // Get max label.
+    label_t maxlabel() const;
 
 private:
-    // Table of label mappings.
-    std::vector<uint8_t> _labels;
+    // Find the representative of a label's equivalence class.
+    label_t find(label_t) const;
+
+    // Max label
+    label_t _maxlabel;
+    // Parent of each label in the disjoint-set forest (path compression 
+    // updates it during lookups).
+    mutable std::vector<label_t> _parent;
+    // Upper bound on the height of each tree
+    std::vector<uint8_t> _rank;
+    // Min label in each equivalence class (valid for representatives only)
+    std::vector<label_t> _minlabel;
 };
 
 }
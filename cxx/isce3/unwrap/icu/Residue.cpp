@@ -1,34 +1,62 @@
-#include <cmath> // round
+#include <algorithm> // std::swap
+#include <vector> // std::vector
 
 #include "ICU.h" // ICU
 
 namespace isce3::unwrap::icu
 {
 
+// Get the integer number of cycles in each wrapped phase difference 
+// (b[i] - a[i]) along a row. Equivalent to round((b[i] - a[i]) / 2pi) for 
+// wrapped phase inputs (|b[i] - a[i]| < 3pi), but free of library calls so 
+// that the loop is vectorizable.
+inline void getPhaseCycles(
+    signed char * cycles,
+    const float * a,
+    const float * b,
+    const size_t n)
+{
+    constexpr float twopi = 2.f * M_PI;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const float d = (b[i] - a[i]) / twopi;
+        cycles[i] = (d >= 0.5f) - (d <= -0.5f);
+    }
+}
+
 void ICU::getResidues(
     signed char * charge, 
     const float * phase, 
     const size_t length, 
     const size_t width)
 {
-    constexpr float twopi = 2.f * M_PI;
+    // The path integral around the 4 pixel neighborhood of pixel (i, j) is
+    //   V(j, i) + H(j+1, i) - V(j, i+1) - H(j, i)
+    // where H(j, i) is the number of cycles in the wrapped phase difference 
+    // from pixel (i, j) to (i+1, j) and V(j, i) is the number from (i, j) to 
+    // (i, j+1). Each difference is computed once per row (rather than once 
+    // for each of the two neighborhoods it borders).
+    std::vector<signed char> hcurr(width), hnext(width), vcurr(width);
+    if (length > 1 && width > 1)
+    {
+        getPhaseCycles(hcurr.data(), &phase[0], &phase[1], width-1);
+    }
 
     // Get residue charge at each pixel (except last row & col).
     for (size_t j = 0; j < length-1; ++j)
     {
+        const float * row0 = &phase[(j+0) * width];
+        const float * row1 = &phase[(j+1) * width];
+        getPhaseCycles(hnext.data(), &row1[0], &row1[1], width-1);
+        getPhaseCycles(vcurr.data(), row0, row1, width);
+
+        signed char * q = &charge[j * width];
         for (size_t i = 0; i < width-1; ++i)
         {
-            // Compute path integral around a 4 pixel neighborhood.
-            float phi_00 = phase[(j+0) * width + (i+0)];
-            float phi_10 = phase[(j+1) * width + (i+0)];
-            float phi_01 = phase[(j+0) * width + (i+1)];
-            float phi_11 = phase[(j+1) * width + (i+1)];
-
-            charge[j * width + i] = round((phi_10 - phi_00) / twopi) + 
-                                    round((phi_11 - phi_10) / twopi) + 
-                                    round((phi_01 - phi_11) / twopi) + 
-                                    round((phi_00 - phi_01) / twopi);
+            q[i] = vcurr[i] + hnext[i] - vcurr[i+1] - hcurr[i];
         }
+
+        std::swap(hcurr, hnext);
     }
 
     // Set last row & col's charge to zero.
@@ -37,4 +65,3 @@ void ICU::getResidues(
 }
 
 }
-
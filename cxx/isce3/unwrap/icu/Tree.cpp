@@ -1,6 +1,8 @@
+#include <cstdint> // uint64_t
 #include <cstring> // std::memcpy
 #include <random> // std::mt19937, std::uniform_real_distribution
 #include <utility> // std::swap
+#include <vector> // std::vector
 
 #include "ICU.h" // ICU, idx2_t, offset2_t
 #include "SearchTable.h" // SearchTable
@@ -30,19 +32,45 @@ void permute(
     }
 }
 
+// Bit-packed mask over a tile
+class BitMask
+{
+public:
+    // Resize to the specified number of bits and clear all bits (reuses 
+    // existing storage if possible).
+    void reset(const size_t size);
+    // Check if the specified bit is set.
+    bool test(const size_t pos) const;
+    // Set the specified bit.
+    void set(const size_t pos);
+    // Clear the specified bit.
+    void clear(const size_t pos);
+private:
+    std::vector<uint64_t> _words;
+};
+
+inline void BitMask::reset(const size_t size) { _words.assign((size + 63) / 64, 0); }
+
+inline bool BitMask::test(const size_t pos) const 
+{ 
+    return (_words[pos / 64] >> (pos % 64)) & 1; 
+}
+
+inline void BitMask::set(const size_t pos) { _words[pos / 64] |= uint64_t(1) << (pos % 64); }
+
+inline void BitMask::clear(const size_t pos) { _words[pos / 64] &= ~(uint64_t(1) << (pos % 64)); }
+
 class Twig
 {
 public:
-    // Constructor
-    Twig(const size_t length, const size_t width);
-    // Destructor
-    ~Twig();
+    // Init (or re-init) an empty twig for a tile of the specified dims.
+    void reset(const size_t length, const size_t width);
     // Add node to end of twig.
     void push(const idx2_t node);
     // Access node at specified position.
     const idx2_t & operator[](const size_t pos) const;
     // Check if twig contains the specified node.
-    bool contains(const idx2_t & node) const;
+    bool contains(const size_t inode) const;
     // Clear twig contents.
     void clear();
     // Get number of nodes on twig.
@@ -51,46 +79,38 @@ private:
     // Twig nodes (residues or neutrons)
     std::vector<idx2_t> _nodes;
     // Mask of nodes on twig
-    bool * _contains;
+    BitMask _contains;
     // Tile width
     size_t _width;
 };
 
-Twig::Twig(const size_t length, const size_t width)
-:
-    _width(width)
+void Twig::reset(const size_t length, const size_t width)
 {
+    _width = width;
+
     // Pre-allocate storage for a large number of nodes.
     const size_t tilesize = length * width;
+    _nodes.clear();
     _nodes.reserve(tilesize/20);
 
     // Init mask of nodes on twig.
-    _contains = new bool[tilesize];
-    for (size_t i = 0; i < tilesize; ++i) { _contains[i] = false; }
+    _contains.reset(tilesize);
 }
 
-Twig::~Twig()
-{
-    delete[] _contains;
-}
-
-void Twig::push(const idx2_t node)
+inline void Twig::push(const idx2_t node)
 {
     _nodes.push_back(node);
-
-    size_t inode = node[1] * _width + node[0];
-    _contains[inode] = true;
+    _contains.set(node[1] * _width + node[0]);
 }
 
-const idx2_t & Twig::operator[](const size_t pos) const
+inline const idx2_t & Twig::operator[](const size_t pos) const
 {
     return _nodes[pos];
 }
 
-bool Twig::contains(const idx2_t & node) const
+inline bool Twig::contains(const size_t inode) const
 {
-    size_t inode = node[1] * _width + node[0];
-    return _contains[inode];
+    return _contains.test(inode);
 }
 
 void Twig::clear()
@@ -98,14 +118,25 @@ void Twig::clear()
     for (size_t t = 0; t < _nodes.size(); ++t)
     {
         idx2_t node = _nodes[t];
-        size_t inode = node[1] * _width + node[0];
-        _contains[inode] = false;
+        _contains.clear(node[1] * _width + node[0]);
     }
     _nodes.clear();
 }
 
 inline size_t Twig::size() const { return _nodes.size(); }
 
+// Per-thread scratch space for growing a tree realization, reused across 
+// realizations and tiles to avoid reallocating tile-sized buffers
+struct TreeArena
+{
+    // Residues/nodes on the un-discharged (currently growing) part of the tree
+    Twig twig;
+    // Mask of nodes visited by any twig in current tree
+    BitMask visited;
+    // Shuffled residue list
+    std::vector<idx2_t> residshfl;
+};
+
 void branchcutHoriz(
     bool * tree,
     size_t i1,
@@ -224,10 +255,10 @@ void branchcut(
 void growTwig(
     bool * tree,
     Twig & twig,
-    bool * visited,
+    BitMask & visited,
     const SearchTable & searchtable,
     const signed char * charge, 
-    const bool * neut, 
+    const BitMask & nodes, 
     const idx2_t & root,
     const size_t length, 
     const size_t width,
@@ -241,7 +272,7 @@ void growTwig(
 
     // Add root residue to twig.
     size_t iroot = root[1] * width + root[0];
-    visited[iroot] = true;
+    visited.set(iroot);
     twigcharge += charge[iroot];
     twig.push(root);
 
@@ -288,17 +319,16 @@ void growTwig(
                 // Check if search point is residue or neutron not already on twig.
                 idx2_t newnode = {node[0] + off[0], node[1] + off[1]};
                 size_t inewnode = newnode[1] * width + newnode[0];
-                if ((charge[inewnode] != 0 || neut[inewnode]) && 
-                    !twig.contains(newnode))
+                if (nodes.test(inewnode) && !twig.contains(inewnode))
                 {
                     // Make branch cut to new node.
                     branchcut(tree, node[0], node[1], newnode[0], newnode[1], width);
 
                     // Check if the new node discharges the twig (if the node 
                     // was previously visited, it is considered neutralized).
-                    if (!visited[inewnode])
+                    if (!visited.test(inewnode))
                     {
-                        visited[inewnode] = true;
+                        visited.set(inewnode);
 
                         twigcharge += charge[inewnode];
                         if (twigcharge == 0) { return; }
@@ -324,59 +354,58 @@ void ICU::growTrees(
     const size_t tilesize = length * width;
     for (size_t i = 0; i < tilesize; ++i) { tree[i] = false; }
 
-    // Get list of residue indices and residue count.
-    auto resid = new idx2_t[tilesize];
-    size_t nresid = 0;
+    // Get list of residue indices and residue count, and bit mask of 
+    // residues & neutrons (candidate twig nodes).
+    std::vector<idx2_t> resid;
+    resid.reserve(tilesize/20);
+    BitMask nodes;
+    nodes.reset(tilesize);
     for (size_t j = 0; j < length; ++j)
     {
         for (size_t i = 0; i < width; ++i)
         {
-            if (charge[j * width + i] != 0)
+            const size_t k = j * width + i;
+            if (charge[k] != 0)
             {
-                resid[nresid] = {i, j};
-                ++nresid;
+                resid.push_back({i, j});
+                nodes.set(k);
+            }
+            else if (neut[k])
+            {
+                nodes.set(k);
             }
         }
     }
+    const size_t nresid = resid.size();
     
     // Construct lookup table of search points in order of increasing distance.
     auto searchtable = SearchTable(_MaxBranchLen, _RatioDxDy);
 
     // Loop over tree realizations (final tree is the union of all realizations).
-    #pragma omp parallel for shared(searchtable)
+    #pragma omp parallel for shared(searchtable, nodes, resid)
     for (int t = 0; t < _NumTrees; ++t)
     {
-        // Twig keeps track of residues/nodes on the un-discharged 
-        // (currently growing) part of the tree
-        auto twig = Twig(length, width);
-
-        // Mask of nodes visited by any twig in current tree
-        auto visited = new bool[tilesize];
-        for (size_t i = 0; i < tilesize; ++i) { visited[i] = false; }
+        thread_local TreeArena arena;
+        arena.twig.reset(length, width);
+        arena.visited.reset(tilesize);
+        arena.residshfl.resize(nresid);
 
         // Loop over a unique random permutation of the residue list.
-        auto residshfl = new idx2_t[nresid];
         auto generator = std::mt19937(seed + t);
-        permute(residshfl, resid, nresid, generator);
-        for (int r = 0; r < nresid; ++r)
+        permute(arena.residshfl.data(), resid.data(), nresid, generator);
+        for (size_t r = 0; r < nresid; ++r)
         {
             // Skip residue if already visited.
-            idx2_t root = residshfl[r];
+            idx2_t root = arena.residshfl[r];
             size_t iroot = root[1] * width + root[0];
-            if (visited[iroot]) { continue; }
+            if (arena.visited.test(iroot)) { continue; }
 
             // Grow twig from residue.
             growTwig(
-                tree, twig, visited, searchtable, charge, neut, root, length, 
-                width, _MaxBranchLen);
+                tree, arena.twig, arena.visited, searchtable, charge, nodes, 
+                root, length, width, _MaxBranchLen);
         }
-
-        delete[] visited;
-        delete[] residshfl;
     }
-
-    delete[] resid;
 }
 
 }
-
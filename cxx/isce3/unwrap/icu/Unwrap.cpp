@@ -1,12 +1,54 @@
+#include <algorithm> // std::min, std::copy_n
+#include <cmath> // round
 #include <complex> // std::complex, std::arg
+#include <cstdint> // UINT8_MAX, UINT16_MAX, UINT32_MAX, INT16_MAX, INT32_MAX
 #include <cstring> // std::memcpy
-#include <exception> // std::domain_error
+#include <memory> // std::make_unique
+#include <exception> // std::domain_error, std::out_of_range, std::exception_ptr
+#include <limits> // std::numeric_limits
+#include <vector> // std::vector
 
-#include "ICU.h" // ICU, isce3::io::Raster, size_t, uint8_t
+#include "ICU.h" // ICU, LabelMap, label_t, isce3::io::Raster, size_t
 
 namespace isce3::unwrap::icu
 {
 
+// Get number of tiles needed to cover the interferogram.
+static int getNumTiles(
+    const size_t length, 
+    const size_t numBufLines, 
+    const size_t numOverlapLines)
+{
+    int ntiles = 1;
+    if (length > numBufLines)
+    {
+        if (numOverlapLines >= numBufLines)
+        {
+            throw std::domain_error("number of overlap lines must be less than number of buffer lines");
+        }
+
+        // Number of lines to next tile
+        const size_t step = numBufLines - numOverlapLines;
+        ntiles = (length + step-1) / step;
+        if (length % step <= numOverlapLines) { --ntiles; }
+    }
+    return ntiles;
+}
+
+// Get the max connected component label representable by the output raster 
+// (labels are limited to 8 bits unless the raster has a wider integer type).
+static label_t getMaxLabel(const isce3::io::Raster & ccl)
+{
+    switch (ccl.dtype())
+    {
+        case GDT_UInt16: return UINT16_MAX;
+        case GDT_Int16: return INT16_MAX;
+        case GDT_UInt32: return UINT32_MAX;
+        case GDT_Int32: return INT32_MAX;
+        default: return UINT8_MAX;
+    }
+}
+
 void ICU::unwrap(
     isce3::io::Raster & unw,
     isce3::io::Raster & ccl,
@@ -14,6 +56,12 @@ void ICU::unwrap(
     isce3::io::Raster & corr,
     unsigned int seed)
 {
+    if (_UseParallelTiles)
+    {
+        unwrapParallelTiles(unw, ccl, intf, corr, seed);
+        return;
+    }
+
     // Raster dims
     const size_t length = intf.length();
     const size_t width = intf.width();
@@ -23,7 +71,7 @@ void ICU::unwrap(
     auto intftile = new std::complex<float>[bufsize];
     auto corrtile = new float[bufsize];
     auto unwtile = new float[bufsize];
-    auto ccltile = new uint8_t[bufsize];
+    auto ccltile = new label_t[bufsize];
 
     // Wrapped phase
     auto phase = new float[bufsize];
@@ -41,25 +89,17 @@ void ICU::unwrap(
     // Bootstrap lines (unwrapped phase and connected component labels)
     const size_t bssize = _NumBsLines * width;
     auto bsunw = new float[bssize];
-    auto bslabels = new uint8_t[bssize];
+    auto bslabels = new label_t[bssize];
 
     // Table of connected component label equivalences
-    auto labelmap = LabelMap();
+    const label_t maxlabel = getMaxLabel(ccl);
+    auto labelmap = LabelMap(maxlabel);
 
     // Number of lines to next tile
     const size_t step = _NumBufLines - _NumOverlapLines;
 
     // Number of tiles
-    int ntiles = 1;
-    if (length > _NumBufLines)
-    {
-        if (step <= 0)
-        {
-            throw std::domain_error("number of overlap lines must be less than number of buffer lines");
-        }
-        ntiles = (length + step-1) / step;
-        if (length % step <= _NumOverlapLines) { --ntiles; }
-    }
+    const int ntiles = getNumTiles(length, _NumBufLines, _NumOverlapLines);
 
     // Loop over tiles.
     for (int t = 0; t < ntiles; ++t)
@@ -106,7 +146,7 @@ void ICU::unwrap(
 
             // Copy bootstrap lines.
             std::memcpy(bsunw, &unwtile[bsoff], _NumBsLines * width * sizeof(float));
-            std::memcpy(bslabels, &ccltile[bsoff], _NumBsLines * width * sizeof(uint8_t));
+            std::memcpy(bslabels, &ccltile[bsoff], _NumBsLines * width * sizeof(label_t));
         }
 
         // Write out unwrapped phase, connected component labels.
@@ -118,7 +158,7 @@ void ICU::unwrap(
     // labelled properly and we are finished. Otherwise, go back and merge 
     // redundant labels.
     bool doUpdateLabels = false;
-    for (uint8_t l = 1; l < labelmap.size(); ++l)
+    for (label_t l = 1; l < labelmap.size(); ++l)
     {
         if (labelmap.getlabel(l) != l) 
         { 
@@ -164,5 +204,245 @@ void ICU::unwrap(
     delete[] bslabels;
 }
 
+void ICU::unwrapParallelTiles(
+    isce3::io::Raster & unw,
+    isce3::io::Raster & ccl,
+    isce3::io::Raster & intf,
+    isce3::io::Raster & corr,
+    unsigned int seed)
+{
+    constexpr float twopi = 2.f * M_PI;
+
+    // Raster dims
+    const size_t length = intf.length();
+    const size_t width = intf.width();
+
+    // Number of lines to next tile
+    const size_t step = _NumBufLines - _NumOverlapLines;
+
+    // Number of tiles
+    const int ntiles = getNumTiles(length, _NumBufLines, _NumOverlapLines);
+
+    // Max connected component label
+    const label_t maxlabel = getMaxLabel(ccl);
+
+    // Bootstrap lines are centered on the middle of the overlap between 
+    // adjacent tiles. Offset to first bootstrap line from start of tile:
+    const size_t bsline = _NumOverlapLines/2 - _NumBsLines/2;
+    const size_t bssize = _NumBsLines * width;
+
+    // Make sure bootstrap lines are not out-of-range of the last tile.
+    if (ntiles > 1)
+    {
+        const size_t lastlen = length - (ntiles-1) * step;
+        if (lastlen < bsline + _NumBsLines)
+        {
+            throw std::out_of_range("bootstrap lines out-of-range");
+        }
+    }
+
+    // Unwrapped phase and connected component labels of each tile in the 
+    // bootstrap lines shared with the previous (head) and next (tail) tile
+    std::vector<float> headunw(ntiles * bssize), tailunw(ntiles * bssize);
+    std::vector<label_t> headccl(ntiles * bssize), tailccl(ntiles * bssize);
+
+    // Number of connected components found in each tile
+    std::vector<size_t> numlabels(ntiles);
+
+    // Unwrap each tile independently. Each tile is written out with its own 
+    // local labels & phase reference, to be reconciled after all tiles are 
+    // processed. The overlap between tiles is split at its midpoint.
+    std::exception_ptr error = nullptr;
+    #pragma omp parallel
+    {
+        // Per-thread buffers for a single tile
+        const size_t bufsize = _NumBufLines * width;
+        std::vector<std::complex<float>> intftile(bufsize);
+        std::vector<float> corrtile(bufsize), unwtile(bufsize), phase(bufsize);
+        std::vector<label_t> ccltile(bufsize);
+        std::vector<signed char> charge(bufsize);
+        auto neut = std::make_unique<bool[]>(bufsize);
+        auto tree = std::make_unique<bool[]>(bufsize);
+        auto currcc = std::make_unique<bool[]>(bufsize);
+
+        #pragma omp for schedule(dynamic)
+        for (int t = 0; t < ntiles; ++t)
+        {
+            try
+            {
+                // Read interferogram, correlation lines.
+                size_t startline = t * step;
+                size_t tilelen = std::min(_NumBufLines, length - startline);
+                #pragma omp critical(icu_raster_io)
+                {
+                    intf.getBlock(intftile.data(), 0, startline, width, tilelen);
+                    corr.getBlock(corrtile.data(), 0, startline, width, tilelen);
+                }
+
+                // Compute wrapped phase.
+                size_t tilesize = tilelen * width;
+                for (size_t i = 0; i < tilesize; ++i) { phase[i] = std::arg(intftile[i]); }
+
+                // Get residue charges, generate neutrons & grow trees.
+                getResidues(charge.data(), phase.data(), tilelen, width);
+                genNeutrons(neut.get(), intftile.data(), corrtile.data(), tilelen, width);
+                growTrees(tree.get(), charge.data(), neut.get(), tilelen, width, seed);
+
+                // Grow grass without bootstrapping, labelling connected 
+                // components from 1 within the tile.
+                auto tilelabels = LabelMap(maxlabel);
+                growGrass<false>(
+                    unwtile.data(), ccltile.data(), currcc.get(), nullptr, 
+                    nullptr, tilelabels, phase.data(), tree.get(), 
+                    corrtile.data(), _InitCorrThr, tilelen, width);
+                numlabels[t] = tilelabels.size() - 1;
+
+                // Save bootstrap lines for stitching.
+                if (t > 0)
+                {
+                    size_t off = bsline * width;
+                    std::copy_n(&unwtile[off], bssize, &headunw[t * bssize]);
+                    std::copy_n(&ccltile[off], bssize, &headccl[t * bssize]);
+                }
+                if (t < ntiles-1)
+                {
+                    size_t off = (step + bsline) * width;
+                    std::copy_n(&unwtile[off], bssize, &tailunw[t * bssize]);
+                    std::copy_n(&ccltile[off], bssize, &tailccl[t * bssize]);
+                }
+
+                // Write out the lines owned by this tile.
+                size_t first = (t == 0) ? 0 : _NumOverlapLines/2;
+                size_t last = (t == ntiles-1) ? tilelen : step + _NumOverlapLines/2;
+                #pragma omp critical(icu_raster_io)
+                {
+                    unw.setBlock(&unwtile[first * width], 0, startline + first, width, last - first);
+                    ccl.setBlock(&ccltile[first * width], 0, startline + first, width, last - first);
+                }
+            }
+            catch (...)
+            {
+                #pragma omp critical(icu_error)
+                if (!error) { error = std::current_exception(); }
+            }
+        }
+    }
+    if (error) { std::rethrow_exception(error); }
+
+    // Stitch tiles in order. Each connected component is assigned a 2pi phase 
+    // offset and a global label from its overlap with the (already stitched) 
+    // previous tile, following the same rules as the sequential bootstrapping.
+    auto labelmap = LabelMap(maxlabel);
+    std::vector<std::vector<float>> phaseoff(ntiles);
+    std::vector<std::vector<label_t>> labels(ntiles);
+    for (int t = 0; t < ntiles; ++t)
+    {
+        const size_t n = numlabels[t];
+        phaseoff[t].assign(n + 1, 0.f);
+        labels[t].assign(n + 1, 0);
+
+        if (t == 0)
+        {
+            for (size_t c = 1; c <= n; ++c) { labels[t][c] = labelmap.nextlabel(); }
+            continue;
+        }
+
+        const float * currunw = &headunw[t * bssize];
+        const label_t * currccl = &headccl[t * bssize];
+        const float * prevunw = &tailunw[(t-1) * bssize];
+        const label_t * prevccl = &tailccl[(t-1) * bssize];
+        const auto & prevoff = phaseoff[t-1];
+        const auto & prevlabels = labels[t-1];
+
+        // Integrate phase differences (squared) in bootstrap overlap region 
+        // for each connected component.
+        std::vector<float> sum(n + 1, 0.f), sumSq(n + 1, 0.f);
+        std::vector<size_t> count(n + 1, 0);
+        for (size_t i = 0; i < bssize; ++i)
+        {
+            const label_t c = currccl[i];
+            const label_t p = prevccl[i];
+            if (c != 0 && p != 0)
+            {
+                float phi = currunw[i] - (prevunw[i] + prevoff[p]);
+                sum[c] += phi;
+                sumSq[c] += phi*phi;
+                ++count[c];
+            }
+        }
+
+        for (size_t c = 1; c <= n; ++c)
+        {
+            // Components with insufficient overlap or too high phase variance 
+            // (which cannot be retried at a higher correlation threshold once 
+            // the tiles are unwrapped) are assigned a new unique label.
+            bool bootstrap = false;
+            if (count[c] >= _MinBsPts)
+            {
+                float mu = sum[c] / float(count[c]);
+                float Sigma = sumSq[c] / float(count[c]) - (mu * mu);
+                if (Sigma < _BsPhaseVarThr)
+                {
+                    phaseoff[t][c] = -twopi * round(mu / twopi);
+                    bootstrap = true;
+                }
+            }
+            if (!bootstrap)
+            {
+                labels[t][c] = labelmap.nextlabel();
+                continue;
+            }
+
+            // Get the min label among overlapping connected components of the 
+            // previous tile and merge the others into it.
+            label_t minlabel = std::numeric_limits<label_t>::max();
+            for (size_t i = 0; i < bssize; ++i)
+            {
+                if (currccl[i] == c && prevccl[i] != 0)
+                {
+                    minlabel = std::min(minlabel, labelmap.getlabel(prevlabels[prevccl[i]]));
+                }
+            }
+            for (size_t i = 0; i < bssize; ++i)
+            {
+                if (currccl[i] == c && prevccl[i] != 0)
+                {
+                    label_t oldlabel = labelmap.getlabel(prevlabels[prevccl[i]]);
+                    if (oldlabel != minlabel) { labelmap.setlabel(oldlabel, minlabel); }
+                }
+            }
+            labels[t][c] = minlabel;
+        }
+    }
+
+    // Apply phase offsets and final labels to each tile's output lines.
+    auto unwtile = std::vector<float>(_NumBufLines * width);
+    auto ccltile = std::vector<label_t>(_NumBufLines * width);
+    for (int t = 0; t < ntiles; ++t)
+    {
+        size_t startline = t * step;
+        size_t tilelen = std::min(_NumBufLines, length - startline);
+        size_t first = (t == 0) ? 0 : _NumOverlapLines/2;
+        size_t last = (t == ntiles-1) ? tilelen : step + _NumOverlapLines/2;
+        size_t nlines = last - first;
+
+        unw.getBlock(unwtile.data(), 0, startline + first, width, nlines);
+        ccl.getBlock(ccltile.data(), 0, startline + first, width, nlines);
+
+        const size_t size = nlines * width;
+        for (size_t i = 0; i < size; ++i)
+        {
+            const label_t c = ccltile[i];
+            if (c != 0)
+            {
+                unwtile[i] += phaseoff[t][c];
+                ccltile[i] = labelmap.getlabel(labels[t][c]);
+            }
+        }
+
+        unw.setBlock(unwtile.data(), 0, startline + first, width, nlines);
+        ccl.setBlock(ccltile.data(), 0, startline + first, width, nlines);
+    }
 }
 
+}
@@ -1690,7 +1690,95 @@ void generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds, Seed *seed
 }
 
 
-DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
+// root of a pixel in the union-find forest of generate_regions() (with path halving)
+static int find_region_root(vector<int>& parent, int k)
+{
+  while(parent[k] != k) {
+    parent[k] = parent[parent[k]];
+    k = parent[k];
+  }
+  return k;
+}
+
+// join the trees of two pixels, keeping the smaller index as the root
+static void union_regions(vector<int>& parent, int a, int b)
+{
+  a = find_region_root(parent, a);
+  b = find_region_root(parent, b);
+  if(a < b) parent[b] = a;
+  else if(b < a) parent[a] = b;
+}
+
+void generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds, Seed *seeds, int **regions, int nr_threads)
+{
+  if(nr_threads <= 1) {
+    generate_regions(flows_patch, nr_seeds, seeds, regions);
+    return;
+  }
+
+  int patch_start = flows_patch->get_extern_start_line();
+  int nr_lines = flows_patch->get_nr_lines() - 1;
+  int nr_pixels = flows_patch->get_nr_pixels() - 1;
+  int not_unwrapped = -1;
+
+  NodeFlow **flows = flows_patch->get_data_lines_ptr();
+
+  // pixels are connected under the same rules as the flood fill of generate_regions(),
+  // i.e. (line, pixel) - (line + 1, pixel) if flows[line + 1][pixel].toRight == 0
+  // and (line, pixel) - (line, pixel + 1) if flows[line][pixel + 1].toDown == 0
+  vector<int> parent((size_t)nr_lines * nr_pixels);
+
+  int nr_strips = min(nr_threads, nr_lines);
+  vector<int> strip_start(nr_strips + 1);
+  for(int k = 0; k <= nr_strips; k++) strip_start[k] = (long long)nr_lines * k / nr_strips;
+
+  // (1) label each strip of lines independently ......
+# pragma omp parallel for num_threads(nr_threads)
+  for(int k = 0; k < nr_strips; k++) {
+    for(int line = strip_start[k]; line < strip_start[k + 1]; line ++) {
+      for(int pixel = 0; pixel < nr_pixels; pixel ++) {
+        int id = line * nr_pixels + pixel;
+        parent[id] = id;
+        if(pixel > 0 && flows[line][pixel].toDown == 0) union_regions(parent, id, id - 1);
+        if(line > strip_start[k] && flows[line][pixel].toRight == 0) union_regions(parent, id, id - nr_pixels);
+      }
+    }
+  }
+
+  // (2) stitch the strips together along their first lines ......
+  for(int k = 1; k < nr_strips; k++) {
+    int line = strip_start[k];
+    for(int pixel = 0; pixel < nr_pixels; pixel ++) {
+      int id = line * nr_pixels + pixel;
+      if(flows[line][pixel].toRight == 0) union_regions(parent, id, id - nr_pixels);
+    }
+  }
+
+  // (3) the first seed found in a region names it ......
+  vector<int> region_of_root(parent.size(), not_unwrapped);
+  for(int seed_id = 0; seed_id < nr_seeds; seed_id ++) {
+    int seed_x = seeds[seed_id].x;
+    int seed_y = seeds[seed_id].y - patch_start;
+    if(seed_y < 0 || seed_y >= nr_lines) continue;
+
+    int root = find_region_root(parent, seed_y * nr_pixels + seed_x);
+    if(region_of_root[root] == not_unwrapped) region_of_root[root] = seed_id;
+  }
+
+  // (4) all roots have a smaller index than their pixels, so resolving the pixels in
+  // index order leaves every parent pointing directly at its root ......
+  for(size_t id = 0; id < parent.size(); id ++) parent[id] = parent[parent[id]];
+
+# pragma omp parallel for num_threads(nr_threads)
+  for(int line = 0; line < nr_lines; line ++) {
+    for(int pixel = 0; pixel < nr_pixels; pixel ++) {
+      regions[line][pixel] = region_of_root[parent[line * nr_pixels + pixel]];
+    }
+  }
+}
+
+
+DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch, int nr_threads)
 {
   int nrows = node_patch->get_nr_lines();
   int ncols = node_patch->get_nr_pixels();
@@ -2209,7 +2297,8 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
 //cerr << "count: " << count << "  point: " << Point(pixel, line) << "  supply: " << (int)nodes[line][pixel].supply << "  dd: " << dd[count] << endl;
       count ++;
     }
-    heapSort (count, dd, indexes);
+    if(nr_threads > 1) parallelSort (count, dd, indexes, nr_threads);
+    else heapSort (count, dd, indexes);
 
 //cerr << "count: " << count << endl;
 //cerr << "end of heapSort() !!!!!! \n";
@@ -70,7 +70,8 @@ struct NodeFlow {
 
 // vector<Flow> solve_assp(DataPatch<Node> *node_patch);
 
-DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch);
+// nr_threads > 1 sorts the demand nodes with parallelSort() instead of heapSort()
+DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch, int nr_threads = 1);
 
 DataPatch<Node> *make_node_patch(int nr_lines, int nr_pixels, float **corr_data, float **phase_data, double qthresh = 0);
 DataPatch<Node> *make_node_patch(DataPatch<fcomplex> *int_patch, double qthresh = 0);
@@ -92,3 +93,5 @@ DataPatch<char>* unwrap_assp(DataPatch<NodeFlow> *flows_patch, float **phase_dat
 
 DataPatch<int> * generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds, Seed *seeds);
 void generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds, Seed *seeds, int **region_map);
+// Same as above, labelling the connected pixels with a union-find over strips of lines processed by nr_threads
+void generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds, Seed *seeds, int **region_map, int nr_threads);
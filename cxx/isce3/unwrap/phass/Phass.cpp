@@ -6,6 +6,148 @@
 
 #include "Phass.h"
 
+#include <algorithm> // std::min, std::max, std::copy_n
+#include <cmath> // M_PI, std::lround
+#include <iostream> // std::cout
+#include <map> // std::map
+#include <memory> // std::unique_ptr
+#include <stdexcept> // std::domain_error
+#include <string> // std::string
+#include <utility> // std::pair
+#include <vector> // std::vector
+
+#include <cpl_conv.h> // CPLGenerateTempFilename
+#include <gdal_priv.h> // GetGDALDriverManager
+
+namespace isce3::unwrap::phass {
+
+// Approximate peak memory used by phass_unwrap per pixel (bytes), including 
+// input buffers, the node/flow networks and the working copies made by ASSP 
+// and the edge detector
+constexpr size_t phassBytesPerPixel = 64;
+
+/**
+ * Unwrap a block of lines in place.
+ *
+ * @param[in,out] phase wrapped phase (unwrapped on output)
+ * @param[in,out] corr correlation (overwritten)
+ * @param[in,out] power interferogram power, or nullptr (overwritten)
+ * @param[out] region_map region index of each pixel (-1 if not unwrapped)
+ * @param[in] numThreads number of threads used by phass_unwrap
+ */
+static void unwrapBlock(float * phase, float * corr, float * power,
+                        int * region_map, const int nrows, const int ncols,
+                        const double corrThr, const double goodCorr,
+                        const int minPixelsPerRegion, const int numThreads)
+{
+    std::vector<float *> phase_data(nrows), corr_data(nrows), power_data(nrows);
+    std::vector<int *> region_data(nrows);
+    for (int line = 0; line < nrows; ++line) {
+        const size_t off = size_t(line) * ncols;
+        phase_data[line] = &phase[off];
+        corr_data[line] = &corr[off];
+        region_data[line] = &region_map[off];
+        if (power) {
+            power_data[line] = &power[off];
+        }
+    }
+
+    phass_unwrap(nrows, ncols, phase_data.data(), corr_data.data(),
+                 power ? power_data.data() : nullptr, region_data.data(),
+                 corrThr, goodCorr, minPixelsPerRegion, numThreads);
+}
+
+/**
+ * Equivalences between regions of different tiles along with the integer 
+ * number of cycles to add to each region's unwrapped phase (relative to the 
+ * representative of its equivalence class) so that they agree.
+ */
+class RegionEquivalence
+{
+public:
+    /** Add a new region and return its id (starting from 1). */
+    int add()
+    {
+        _parent.push_back(_parent.size());
+        _cycles.push_back(0);
+        return _parent.size() - 1;
+    }
+
+    /** Get representative (min id) of a region's class and its cycle offset. */
+    std::pair<int, long> find(const int id)
+    {
+        if (_parent[id] == id) {
+            return {id, 0};
+        }
+        auto [root, cycles] = find(_parent[id]);
+        // path compression
+        _parent[id] = root;
+        _cycles[id] += cycles;
+        return {root, _cycles[id]};
+    }
+
+    /**
+     * Merge two regions whose unwrapped phase differs by 2pi * k, 
+     * (phase_a - phase_b). Inconsistent merges of regions that are already 
+     * equivalent are ignored.
+     */
+    void merge(const int a, const int b, const long k)
+    {
+        auto [ra, ca] = find(a);
+        auto [rb, cb] = find(b);
+        if (ra == rb) {
+            return;
+        }
+        // cycles(a) - cycles(b) = -k
+        if (ra < rb) {
+            _parent[rb] = ra;
+            _cycles[rb] = k + ca - cb;
+        } else {
+            _parent[ra] = rb;
+            _cycles[ra] = -k - ca + cb;
+        }
+    }
+
+    /** Number of region ids (including unused id 0) */
+    int size() const { return _parent.size(); }
+
+private:
+    std::vector<int> _parent = {0};
+    std::vector<long> _cycles = {0};
+};
+
+/**
+ * Single band raster in a temporary file that is deleted when it goes out 
+ * of scope.
+ */
+class ScratchRaster
+{
+public:
+    ScratchRaster(const size_t width, const size_t length,
+                  const GDALDataType dtype) :
+        _fname(CPLGenerateTempFilename("phass")),
+        _raster(std::make_unique<isce3::io::Raster>(
+                    _fname, width, length, 1, dtype, "ENVI"))
+    {}
+
+    ~ScratchRaster()
+    {
+        _raster.reset();
+        GetGDALDriverManager()->GetDriverByName("ENVI")->Delete(_fname.c_str());
+    }
+
+    ScratchRaster(const ScratchRaster &) = delete;
+    ScratchRaster & operator=(const ScratchRaster &) = delete;
+
+    isce3::io::Raster & raster() { return *_raster; }
+
+private:
+    std::string _fname;
+    std::unique_ptr<isce3::io::Raster> _raster;
+};
+
+}
+
 /**
  * @param[in] phaseRaster wrapped phase
  * @param[in] corrRaster correlation
@@ -47,79 +189,212 @@ unwrap(isce3::io::Raster & phaseRaster,
     int nrows = phaseRaster.length();
     int ncols = phaseRaster.width();
 
-    float *phase_data_1D = new float[nrows*ncols];
-    float *corr_data_1D = new float[nrows*ncols];
-    float *power_data_1D = new float[nrows*ncols];
+    // Unwrap in tiles if the full scene does not fit in the memory budget.
+    if (numTiles(nrows, ncols) > 1) {
+        const size_t tileLines = _memoryBudget / (phassBytesPerPixel * ncols);
+        unwrapTiled(phaseRaster, powerRaster, corrRaster, unwRaster,
+                    labelRaster, tileLines);
+        return;
+    }
+
+    const size_t size = size_t(nrows) * ncols;
+    std::vector<float> phase_data(size), corr_data(size), power_data;
+    std::vector<int> region_map(size);
 
-    phaseRaster.getBlock(phase_data_1D, 0, 0, ncols, nrows);
-    corrRaster.getBlock(corr_data_1D, 0, 0, ncols, nrows);
+    phaseRaster.getBlock(phase_data.data(), 0, 0, ncols, nrows);
+    corrRaster.getBlock(corr_data.data(), 0, 0, ncols, nrows);
 
     if (_usePower) {
-        powerRaster.getBlock(power_data_1D, 0, 0, ncols, nrows);
+        power_data.resize(size);
+        powerRaster.getBlock(power_data.data(), 0, 0, ncols, nrows);
     }
 
-    float **phase_data  = new float*[nrows];
-    float **corr_data   = new float*[nrows]; 
-    float **power_data  = new float*[nrows];
-        
-        
-    int **region_map = new int*[nrows];
-    for (int line=0; line<nrows; line++){
-        region_map[line] = new int[ncols];
+    unwrapBlock(phase_data.data(), corr_data.data(),
+                _usePower ? power_data.data() : nullptr, region_map.data(),
+                nrows, ncols, _correlationThreshold, _goodCorrelation,
+                _minPixelsPerRegion, _numThreads);
+
+    unwRaster.setBlock(phase_data.data(), 0, 0, ncols, nrows);
+
+    std::vector<float> labels(size);
+    for (size_t i = 0; i < size; ++i) {
+        labels[i] = region_map[i] + 1;
     }
 
-    for (int line = 0 ; line < nrows ; ++line) {
-        phase_data[line] = &phase_data_1D[line*ncols];
-        corr_data[line] = &corr_data_1D[line*ncols];
+    labelRaster.setBlock(labels.data(), 0, 0, ncols, nrows);
+}
+
+/**
+* @param[in] nrows number of lines of the scene
+* @param[in] ncols number of samples of the scene
+*/
+int isce3::unwrap::phass::Phass::
+numTiles(const int nrows, const int ncols) const
+{
+    if (_memoryBudget == 0) {
+        return 1;
     }
 
-    if (_usePower) {
-        for (int line = 0 ; line < nrows ; ++line) {
-            power_data[line] = &power_data_1D[line*ncols];
-        }
-    } else {
-        power_data  = NULL;
+    const size_t tileLines = _memoryBudget / (phassBytesPerPixel * ncols);
+    if (tileLines >= size_t(nrows)) {
+        return 1;
     }
 
+    // Number of lines to next tile
+    const int step = int(tileLines) - _numOverlapLines;
+    if (step <= 0) {
+        throw std::domain_error("memory budget too small for the number of overlap lines");
+    }
 
-    phass_unwrap(nrows, ncols, 
-                phase_data, corr_data, power_data, region_map,
-                _correlationThreshold, _goodCorrelation,  _minPixelsPerRegion); 
+    return 1 + (nrows - int(tileLines) + step - 1) / step;
+}
 
-    for (size_t line = 0; line < nrows; ++line) {
-        for (size_t col = 0; col < ncols; ++col) {
-            phase_data_1D[line*ncols + col] = phase_data[line][col];
-        }
+/**
+* @param[in] phaseRaster wrapped phase
+* @param[in] powerRaster power of the interferogram
+* @param[in] corrRaster correlation
+* @param[out] unwRaster unwrapped phase
+* @param[out] labelRaster connected component labels
+* @param[in] tileLines number of lines per tile
+*/
+void isce3::unwrap::phass::Phass::
+unwrapTiled(isce3::io::Raster & phaseRaster,
+        isce3::io::Raster & powerRaster,
+        isce3::io::Raster & corrRaster,
+        isce3::io::Raster & unwRaster,
+        isce3::io::Raster & labelRaster,
+        const int tileLines)
+{
+    constexpr double twopi = 2.0 * M_PI;
+
+    const int nrows = phaseRaster.length();
+    const int ncols = phaseRaster.width();
+
+    // Number of lines to next tile
+    const int overlap = _numOverlapLines;
+    const int step = tileLines - overlap;
+    if (step <= 0) {
+        throw std::domain_error("memory budget too small for the number of overlap lines");
     }
 
-    unwRaster.setBlock(phase_data_1D, 0, 0, ncols, nrows);
+    // Number of tiles
+    const int ntiles = numTiles(nrows, ncols);
 
-    float *labels_1D = new float[nrows*ncols];
-    for (size_t line = 0; line < nrows; ++line) {
-        for (size_t col = 0; col < ncols; ++col) {
-            labels_1D[line*ncols + col] = region_map[line][col] + 1;
-        }
+    // Region ids are unique across tiles. They are kept in a scratch raster 
+    // until the final labels are known, since there may be more of them than 
+    // the data type of labelRaster can hold.
+    RegionEquivalence regions;
+    ScratchRaster idsRaster(ncols, nrows, GDT_Int32);
+
+    // Unwrapped phase & region ids of the previous tile's overlap lines
+    const size_t ovlsize = size_t(overlap) * ncols;
+    std::vector<float> prevunw(ovlsize);
+    std::vector<int> previds(ovlsize);
+
+    // Buffers for a single tile
+    const size_t bufsize = size_t(tileLines) * ncols;
+    std::vector<float> phase(bufsize), corr(bufsize), power;
+    std::vector<int> region_map(bufsize), ids(bufsize);
+    if (_usePower) {
+        power.resize(bufsize);
     }
 
-    labelRaster.setBlock(labels_1D, 0, 0, ncols, nrows);
-    
-    /*for (int line = 0; line <nrows; ++line) {
-        std::cout << line << std::endl;
-        delete[] phase_data[line];
-        delete[] corr_data[line];
-        delete[] power_data[line];
-        delete[] region_map[line];
-    }*/ 
+    // Lines of each tile written to the output (the overlap between tiles 
+    // is split at its midpoint)
+    auto ownedLines = [&](const int t) {
+        const int startline = t * step;
+        const int tilelen = std::min(tileLines, nrows - startline);
+        const int first = (t == 0) ? 0 : overlap / 2;
+        const int last = (t == ntiles - 1) ? tilelen : step + overlap / 2;
+        return std::pair<int, int>(startline + first, last - first);
+    };
 
-    delete[] labels_1D;
-    delete[] phase_data_1D;
-    delete[] power_data_1D;
+    for (int t = 0; t < ntiles; ++t) {
+        const int startline = t * step;
+        const int tilelen = std::min(tileLines, nrows - startline);
+        const size_t tilesize = size_t(tilelen) * ncols;
 
-    delete[] phase_data;
-    delete[] corr_data;
-    delete[] power_data;
-    delete[] region_map;   
+        phaseRaster.getBlock(phase.data(), 0, startline, ncols, tilelen);
+        corrRaster.getBlock(corr.data(), 0, startline, ncols, tilelen);
+        if (_usePower) {
+            powerRaster.getBlock(power.data(), 0, startline, ncols, tilelen);
+        }
 
-}
+        unwrapBlock(phase.data(), corr.data(),
+                    _usePower ? power.data() : nullptr, region_map.data(),
+                    tilelen, ncols, _correlationThreshold, _goodCorrelation,
+                    _minPixelsPerRegion, _numThreads);
 
+        // Assign each region in the tile a unique id (0 if not unwrapped).
+        int nregions = 0;
+        for (size_t i = 0; i < tilesize; ++i) {
+            nregions = std::max(nregions, region_map[i] + 1);
+        }
+        const int base = regions.size() - 1;
+        for (int r = 0; r < nregions; ++r) {
+            regions.add();
+        }
+        for (size_t i = 0; i < tilesize; ++i) {
+            ids[i] = (region_map[i] >= 0) ? base + region_map[i] + 1 : 0;
+        }
 
+        // Link regions overlapping regions of the previous tile, using the 
+        // most common integer cycle difference between them.
+        if (t > 0) {
+            std::map<std::pair<int, int>, std::map<long, int>> votes;
+            for (size_t i = 0; i < ovlsize; ++i) {
+                if (ids[i] != 0 && previds[i] != 0) {
+                    long k = std::lround((phase[i] - prevunw[i]) / twopi);
+                    ++votes[{ids[i], previds[i]}][k];
+                }
+            }
+            for (const auto & [pair, counts] : votes) {
+                auto best = std::max_element(counts.begin(), counts.end(),
+                        [](const auto & a, const auto & b) {
+                            return a.second < b.second;
+                        });
+                regions.merge(pair.first, pair.second, best->first);
+            }
+        }
+
+        // Save overlap lines for the next tile.
+        if (t < ntiles - 1) {
+            const size_t off = size_t(step) * ncols;
+            std::copy_n(&phase[off], ovlsize, prevunw.data());
+            std::copy_n(&ids[off], ovlsize, previds.data());
+        }
+
+        // Write out unwrapped phase & region ids.
+        auto [line, nlines] = ownedLines(t);
+        const size_t off = size_t(line - startline) * ncols;
+        unwRaster.setBlock(&phase[off], 0, line, ncols, nlines);
+        idsRaster.raster().setBlock(&ids[off], 0, line, ncols, nlines);
+    }
+
+    // Number the equivalence classes consecutively from 1 (in order of 
+    // their first appearance) and get each region's cycle offset.
+    std::vector<int> labels(regions.size(), 0);
+    std::vector<long> cycles(regions.size(), 0);
+    int nlabels = 0;
+    for (int id = 1; id < regions.size(); ++id) {
+        auto [root, k] = regions.find(id);
+        labels[id] = (root == id) ? ++nlabels : labels[root];
+        cycles[id] = k;
+    }
+
+    // Apply final labels & cycle offsets.
+    for (int t = 0; t < ntiles; ++t) {
+        auto [line, nlines] = ownedLines(t);
+        const size_t size = size_t(nlines) * ncols;
+        unwRaster.getBlock(phase.data(), 0, line, ncols, nlines);
+        idsRaster.raster().getBlock(ids.data(), 0, line, ncols, nlines);
+        for (size_t i = 0; i < size; ++i) {
+            if (ids[i] != 0) {
+                phase[i] += twopi * cycles[ids[i]];
+                ids[i] = labels[ids[i]];
+            }
+        }
+        unwRaster.setBlock(phase.data(), 0, line, ncols, nlines);
+        labelRaster.setBlock(ids.data(), 0, line, ncols, nlines);
+    }
+}
@@ -63,12 +63,59 @@ public:
     /** Set minimum size of a region to be unwrapped. */
     void minPixelsPerRegion(const int);
 
+    /** Get memory budget for unwrapping (bytes). */
+    size_t memoryBudget() const;
+
+    /** 
+     * Set memory budget for unwrapping (bytes). If the scene does not fit in 
+     * the budget, it is unwrapped in overlapping tiles of lines whose region 
+     * labels and integer cycle offsets are reconciled afterwards. The 
+     * intermediate region ids are kept in a temporary file in CPL_TMPDIR 
+     * (the working directory if unset). Zero (default) unwraps the full 
+     * scene at once.
+     */
+    void memoryBudget(const size_t);
+
+    /** Get lines of overlap between tiles. */
+    int numOverlapLines() const;
+
+    /** Set lines of overlap between tiles (default: 200). */
+    void numOverlapLines(const int);
+
+    /** Get number of threads used for unwrapping. */
+    int numThreads() const;
+
+    /**
+     * Set number of threads used for unwrapping. With more than one thread, 
+     * the weights, the ordering of the residues in the flow solver and the 
+     * region labels are computed in parallel. One (default) runs the 
+     * original single-threaded algorithms.
+     */
+    void numThreads(const int);
+
+    /**
+     * Number of tiles a scene of nrows x ncols is unwrapped in for the 
+     * current memory budget and overlap (1 if it is unwrapped at once).
+     */
+    int numTiles(const int nrows, const int ncols) const;
 
     private:
+        /** Unwrap the scene in overlapping tiles of tileLines lines. */
+        void unwrapTiled(
+            isce3::io::Raster & phaseRaster,
+            isce3::io::Raster & powerRaster,
+            isce3::io::Raster & corrRaster,
+            isce3::io::Raster & unwRaster,
+            isce3::io::Raster & labelRaster,
+            const int tileLines);
+
         double _correlationThreshold = 0.2;
         double _goodCorrelation = 0.7; 
         int _minPixelsPerRegion = 200.0;
         bool _usePower = true;
+        size_t _memoryBudget = 0;
+        int _numOverlapLines = 200;
+        int _numThreads = 1;
 
 };
 
@@ -27,7 +27,7 @@
 #endif
 
 void phass_unwrap(int nr_lines, int nr_pixels, float **phase_data, float **corr_data, float **power_data, int **region_map,
-		  double corr_th, double good_corr, int min_pixels_per_region)
+		  double corr_th, double good_corr, int min_pixels_per_region, int nr_threads)
 {
 
   cerr << "phass_unwrap input parameters:: ......\n";
@@ -36,6 +36,7 @@ void phass_unwrap(int nr_lines, int nr_pixels, float **phase_data, float **corr_
   cerr << "     corr_th: " << corr_th << endl;
   cerr << "     good_corr: " << good_corr << endl;
   cerr << "     min_pixels_per_region: " << min_pixels_per_region << endl;
+  cerr << "     nr_threads: " << nr_threads << endl;
 /*
   {
     fcomplex *int_data = new fcomplex[nr_pixels];
@@ -71,6 +72,7 @@ void phass_unwrap(int nr_lines, int nr_pixels, float **phase_data, float **corr_
   double phase_diff_th = 1.0; // radians
 
   // default to square the corr_data ......
+# pragma omp parallel for num_threads(nr_threads)
   for(int line = 0; line < nr_lines; line ++) {
     for(int pixel = 0; pixel < nr_pixels; pixel ++) {
       corr_data[line][pixel] *= corr_data[line][pixel];
@@ -86,6 +88,7 @@ void phass_unwrap(int nr_lines, int nr_pixels, float **phase_data, float **corr_
 
   DataPatch<Node> *node_patch = new DataPatch<Node>(ncols, nrows);
   Node **node_data = node_patch->get_data_lines_ptr();
+# pragma omp parallel for num_threads(nr_threads)
   for(int row = 0; row < nrows; row++) {
     for(int col = 0; col < ncols; col ++) {
       node_data[row][col].supply = 0;
@@ -96,8 +99,9 @@ void phass_unwrap(int nr_lines, int nr_pixels, float **phase_data, float **corr_
 
   double pi = PI;
   double two_pi = 2.0 * PI;
-  float *phases = new float[5];
+# pragma omp parallel for num_threads(nr_threads)
   for(int line=1; line<nr_lines; line++) {
+    float phases[5];
     for(int pixel=1; pixel<nr_pixels; pixel++) {
       phases[0] = phase_data[line-1][pixel-1];
       phases[1] = phase_data[line][pixel-1];
@@ -113,11 +117,11 @@ void phass_unwrap(int nr_lines, int nr_pixels, float **phase_data, float **corr_
       node_data[line][pixel].supply = flag;
     }
   }
-  delete[] phases;
 
-  double x, y;
   int mask_th = good_corr * cost_scale;
+# pragma omp parallel for num_threads(nr_threads)
   for(int line = 0; line < nrows; line++) {
+    double x, y;
     for(int pixel = 0; pixel < ncols; pixel ++) {
       if(line == 0) {        // For the first row ......
 	if(pixel > 0 && pixel < ncols - 1) {
@@ -148,6 +152,7 @@ void phass_unwrap(int nr_lines, int nr_pixels, float **phase_data, float **corr_
     float mid = 8.0;
     int gw = 7;
     double gws = 1.0;
+# pragma omp parallel for num_threads(nr_threads)
     for(int i = 0; i < nr_lines; i++) {
       for(int j = 0; j < nr_pixels; j++) {
         power_data[i][j] = 10.0*log10(power_data[i][j]+1.0e-20);  // for power inputs
@@ -170,8 +175,9 @@ void phass_unwrap(int nr_lines, int nr_pixels, float **phase_data, float **corr_
 
 
   double max_dph = phase_diff_th; //1.0; // PI/2.0;
-  double dx = 0;
+# pragma omp parallel for num_threads(nr_threads)
   for(int line = 0; line < nrows; line++) {
+    double dx = 0;
     for(int pixel = 0; pixel < ncols; pixel ++) {
       if(line == 0) {        // For the first row ......
 	if(pixel > 0 && pixel < ncols - 1) {
@@ -263,7 +269,7 @@ void phass_unwrap(int nr_lines, int nr_pixels, float **phase_data, float **corr_
 
 // (2) seek minimum cost flow solution ..........
 
-  DataPatch<NodeFlow> *flows = solve(node_patch);
+  DataPatch<NodeFlow> *flows = solve(node_patch, nr_threads);
   NodeFlow **flow_data = flows->get_data_lines_ptr();
 
 //  FILE *fp_flow = fopen("June20.int.flow", "r");
@@ -284,6 +290,7 @@ void phass_unwrap(int nr_lines, int nr_pixels, float **phase_data, float **corr_
     }
     uchar th = cost_scale * corr_th;
       cerr << "***** th: " << (int) th << endl;
+# pragma omp parallel for num_threads(nr_threads)
     for(int line = 0; line < nrows; line ++) {
       for(int pixel = 0; pixel < ncols; pixel ++) {
 	if(node_data[line][pixel].rc < th && flow_data[line][pixel].toRight == 0) {
@@ -310,7 +317,7 @@ void phass_unwrap(int nr_lines, int nr_pixels, float **phase_data, float **corr_
   DataPatch<char> *visit_patch = unwrap_adjust_seeds(flows, phase_data, nr_seeds, seeds); // unwrap only
   delete visit_patch;
 
-  generate_regions(flows, nr_seeds, seeds, region_map);
+  generate_regions(flows, nr_seeds, seeds, region_map, nr_threads);
 
 
   delete[] seeds;
@@ -14,5 +14,7 @@
 
 #pragma once
 
+// nr_threads: threads used for the weight computation, the sorting of the demand nodes in the
+// flow solver and the region labelling (1 runs the original single-threaded algorithms)
 void phass_unwrap(int nr_lines, int nr_pixels, float **phase_data, float **corr_data, float **power, int **region_map,
-		  double corr_th, double good_corr, int min_pixels_per_region);
+		  double corr_th, double good_corr, int min_pixels_per_region, int nr_threads = 1);
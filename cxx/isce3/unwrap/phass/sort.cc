@@ -16,9 +16,75 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h> 
+#include <algorithm>
+#include <functional>
+#include <vector>
 
 using namespace std;
 
+// Sort indexes[0 .. n) by vals[indexes[]] using nr_threads: each thread sorts one
+// contiguous run, then pairs of neighbouring runs are merged in parallel until one is left.
+template<typename T, typename Compare>
+static void parallelMergeSort(int n, const T *vals, int *indexes, int nr_threads, Compare comp)
+{
+  auto less = [&](int a, int b) { return comp(vals[a], vals[b]); };
+
+  int nr_runs = min(nr_threads, max(n / 1024, 1));
+  vector<int> bounds(nr_runs + 1);
+  for(int k = 0; k <= nr_runs; k++) bounds[k] = (long long)n * k / nr_runs;
+
+# pragma omp parallel for num_threads(nr_threads)
+  for(int k = 0; k < nr_runs; k++) {
+    stable_sort(indexes + bounds[k], indexes + bounds[k + 1], less);
+  }
+
+  vector<int> work(n);
+  int *src = indexes;
+  int *dst = work.data();
+  for(int width = 1; width < nr_runs; width *= 2) {
+# pragma omp parallel for num_threads(nr_threads)
+    for(int k = 0; k < nr_runs; k += 2 * width) {
+      int start = bounds[k];
+      int mid = bounds[min(k + width, nr_runs)];
+      int end = bounds[min(k + 2 * width, nr_runs)];
+      merge(src + start, src + mid, src + mid, src + end, dst + start, less);
+    }
+    swap(src, dst);
+  }
+  if(src != indexes) copy(src, src + n, indexes);
+}
+
+template<typename T>
+static void parallelSortImpl(int n, T *vals, int *indexes, int nr_threads, int order)
+{
+  if(nr_threads <= 1) {
+    heapSort(n, vals, indexes, order);
+    return;
+  }
+  if(order == 0) {
+    parallelMergeSort(n, vals, indexes, nr_threads, less<T>());
+  }
+  else {
+    for(int a = 0; a < n; a++) indexes[a] = a;
+    parallelMergeSort(n, vals, indexes, nr_threads, greater<T>());
+  }
+}
+
+void parallelSort(int n, int *vals, int *indexes, int nr_threads, int order)
+{
+  parallelSortImpl(n, vals, indexes, nr_threads, order);
+}
+
+void parallelSort(int n, double *vals, int *indexes, int nr_threads, int order)
+{
+  parallelSortImpl(n, vals, indexes, nr_threads, order);
+}
+
+void parallelSort(int n, float *vals, int *indexes, int nr_threads, int order)
+{
+  parallelSortImpl(n, vals, indexes, nr_threads, order);
+}
+
 void heapSort(int n, int *vals, int *indexes, int order)
 {
   int a, tmp;
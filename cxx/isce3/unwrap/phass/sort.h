@@ -21,6 +21,13 @@ void	heapSort (int n, double *val, int *indexes, int order = 0);  //   order ==
 void	heapSort (int n, float *val, int *indexes, int order = 0);  //   order == 0: small to large;  order == 1: large to small; 
 void	heapSort (int n, int *val, int *indexes, int order = 0);  //   order == 0: small to large;  order == 1: large to small; 
 
+// Multi-threaded counterparts of heapSort() with the same calling convention (stable merge sort,
+// so entries with equal values may come out in a different order than with heapSort()).
+// nr_threads <= 1 falls back to heapSort().
+void	parallelSort (int n, double *val, int *indexes, int nr_threads, int order = 0);
+void	parallelSort (int n, float *val, int *indexes, int nr_threads, int order = 0);
+void	parallelSort (int n, int *val, int *indexes, int nr_threads, int order = 0);
+
 void medium_filtering(int n, double *data, int win, double nodata);
 void medium_filtering(int n, float *data, int win, float nodata);
 float median_of_medians(int n, float *data, int rank);
@@ -12,6 +12,7 @@ from Ellipsoid cimport Ellipsoid
 from Raster  cimport Raster
 from libcpp.string cimport string
 from libcpp cimport bool
+from libcpp.vector cimport vector
 
 cdef extern from "isce3/geocode/geocodeSlc.h" namespace "isce3::geocode":
     void geocodeSlc(Raster & outputRaster,
@@ -29,3 +30,23 @@ cdef extern from "isce3/geocode/geocodeSlc.h" namespace "isce3::geocode":
         const double & demBlockMargin,
         const bool flatten)
 
+    void geocodeSlc(const vector[Raster *] & outputRasters,
+        const vector[Raster *] & inputRasters,
+        Raster & demRaster,
+        const RadarGridParameters & radarGrid,
+        const GeoGridParameters & geoGrid,
+        const Orbit& orbit,
+        const LUT2d[double]& nativeDoppler,
+        const LUT2d[double]& imageGridDoppler,
+        const Ellipsoid & ellipsoid,
+        const double & thresholdGeo2rdr,
+        const int & numiterGeo2rdr,
+        const size_t & linesPerBlock,
+        const double & demBlockMargin,
+        const bool flatten)
+
+    size_t geocodeSlcLinesPerBlock(Raster & demRaster,
+        const RadarGridParameters & radarGrid,
+        const GeoGridParameters & geoGrid,
+        const double & demBlockMargin,
+        const size_t & memoryBudget)
@@ -34,3 +34,55 @@ def pygeocodeSlc(pyRaster outputGSlc,
             flatten)
 
     return 
+
+def pygeocodeSlcRasters(list outputGSlcs,
+        list inputRSlcs,
+        pyRaster dem,
+        pyRadarGridParameters radarGrid,
+        pyGeoGridParameters geoGrid,
+        pyOrbit orbit,
+        pyLUT2d nativeDoppler,
+        pyLUT2d imageGridDoppler,
+        pyEllipsoid ellipsoid,
+        double thresholdGeo2rdr,
+        int numiterGeo2rdr,
+        size_t linesPerBlock,
+        double demBlockMargin,
+        bool flatten):
+
+    # rasters sharing the radar grid, geocoded in a single pass
+    cdef vector[Raster *] outputRasters
+    cdef vector[Raster *] inputRasters
+    for raster in outputGSlcs:
+        outputRasters.push_back((<pyRaster>raster).c_raster)
+    for raster in inputRSlcs:
+        inputRasters.push_back((<pyRaster>raster).c_raster)
+
+    geocodeSlc(outputRasters,
+            inputRasters,
+            deref(dem.c_raster),
+            deref(radarGrid.c_radargrid),
+            deref(geoGrid.c_geogrid),
+            orbit.c_orbit,
+            deref(nativeDoppler.c_lut),
+            deref(imageGridDoppler.c_lut),
+            deref(ellipsoid.c_ellipsoid),
+            thresholdGeo2rdr,
+            numiterGeo2rdr,
+            linesPerBlock,
+            demBlockMargin,
+            flatten)
+
+    return
+
+def pygeocodeSlcLinesPerBlock(pyRaster dem,
+        pyRadarGridParameters radarGrid,
+        pyGeoGridParameters geoGrid,
+        double demBlockMargin,
+        size_t memoryBudget):
+
+    return geocodeSlcLinesPerBlock(deref(dem.c_raster),
+            deref(radarGrid.c_radargrid),
+            deref(geoGrid.c_geogrid),
+            demBlockMargin,
+            memoryBudget)
@@ -23,6 +23,7 @@ geocode/geocode.cpp
 geocode/GeocodeSlc.cpp
 geometry/boundingbox.cpp
 geometry/DEMInterpolator.cpp
+geometry/DEMTileCache.cpp
 geometry/Geocode.cpp
 geometry/geometry.cpp
 geometry/geo2rdr.cpp
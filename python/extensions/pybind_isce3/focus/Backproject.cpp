@@ -6,6 +6,7 @@
 #include <isce3/focus/Backproject.h>
 #include <isce3/focus/DryTroposphereModel.h>
 #include <isce3/geometry/DEMInterpolator.h>
+#include <isce3/io/Raster.h>
 #include <pybind11/numpy.h>
 
 namespace py = pybind11;
@@ -16,6 +17,52 @@ using isce3::container::RadarGeometry;
 using isce3::core::Kernel;
 using isce3::except::InvalidArgument;
 using isce3::geometry::DEMInterpolator;
+using isce3::io::Raster;
+
+static Rdr2GeoParams parseRdr2GeoParams(py::dict rdr2geo_params)
+{
+    Rdr2GeoParams r2gparams;
+    if (rdr2geo_params.contains("threshold")) {
+        r2gparams.threshold = py::float_(rdr2geo_params["threshold"]);
+    }
+    if (rdr2geo_params.contains("maxiter")) {
+        r2gparams.maxiter = py::int_(rdr2geo_params["maxiter"]);
+    }
+    if (rdr2geo_params.contains("extraiter")) {
+        r2gparams.extraiter = py::int_(rdr2geo_params["extraiter"]);
+    }
+    return r2gparams;
+}
+
+static Geo2RdrParams parseGeo2RdrParams(py::dict geo2rdr_params)
+{
+    Geo2RdrParams g2rparams;
+    if (geo2rdr_params.contains("threshold")) {
+        g2rparams.threshold = py::float_(geo2rdr_params["threshold"]);
+    }
+    if (geo2rdr_params.contains("maxiter")) {
+        g2rparams.maxiter = py::int_(geo2rdr_params["maxiter"]);
+    }
+    if (geo2rdr_params.contains("dr")) {
+        g2rparams.delta_range = py::float_(geo2rdr_params["dr"]);
+    }
+    return g2rparams;
+}
+
+static TileParams parseTileParams(py::dict tile_params)
+{
+    TileParams tparams;
+    if (tile_params.contains("azimuth_tile")) {
+        tparams.azimuth_tile = py::int_(tile_params["azimuth_tile"]);
+    }
+    if (tile_params.contains("range_tile")) {
+        tparams.range_tile = py::int_(tile_params["range_tile"]);
+    }
+    if (tile_params.contains("pulse_block")) {
+        tparams.pulse_block = py::int_(tile_params["pulse_block"]);
+    }
+    return tparams;
+}
 
 void addbinding_backproject(py::module& m)
 {
@@ -30,7 +77,8 @@ void addbinding_backproject(py::module& m)
                 const Kernel<float>& kernel,
                 const std::string& dry_tropo_model,
                 py::dict rdr2geo_params,
-                py::dict geo2rdr_params) {
+                py::dict geo2rdr_params,
+                py::dict tile_params) {
 
             if (out.ndim() != 2) {
                 throw InvalidArgument(ISCE_SRCINFO(), "output array must be 2-D");
@@ -61,33 +109,78 @@ void addbinding_backproject(py::module& m)
 
             DryTroposphereModel atm = parseDryTropoModel(dry_tropo_model);
 
-            Rdr2GeoParams r2gparams;
-            if (rdr2geo_params.contains("threshold")) {
-                r2gparams.threshold = py::float_(rdr2geo_params["threshold"]);
-            }
-            if (rdr2geo_params.contains("maxiter")) {
-                r2gparams.maxiter = py::int_(rdr2geo_params["maxiter"]);
-            }
-            if (rdr2geo_params.contains("extraiter")) {
-                r2gparams.extraiter = py::int_(rdr2geo_params["extraiter"]);
-            }
+            Rdr2GeoParams r2gparams = parseRdr2GeoParams(rdr2geo_params);
+            Geo2RdrParams g2rparams = parseGeo2RdrParams(geo2rdr_params);
 
-            Geo2RdrParams g2rparams;
-            if (geo2rdr_params.contains("threshold")) {
-                g2rparams.threshold = py::float_(geo2rdr_params["threshold"]);
-            }
-            if (geo2rdr_params.contains("maxiter")) {
-                g2rparams.maxiter = py::int_(geo2rdr_params["maxiter"]);
-            }
-            if (geo2rdr_params.contains("dr")) {
-                g2rparams.delta_range = py::float_(geo2rdr_params["dr"]);
+            if (tile_params.empty()) {
+                backproject(out_data, out_geometry, in_data, in_geometry, dem,
+                        fc, ds, kernel, atm, r2gparams, g2rparams);
+                return;
             }
 
+            TileParams tparams = parseTileParams(tile_params);
             backproject(out_data, out_geometry, in_data, in_geometry, dem, fc,
-                    ds, kernel, atm, r2gparams, g2rparams);
+                    ds, kernel, atm, r2gparams, g2rparams, tparams);
             },
             R"(
                 Focus in azimuth via time-domain backprojection.
+
+                If `tile_params` is non-empty, the output grid is processed in
+                tiles of `azimuth_tile` x `range_tile` targets, integrating
+                `pulse_block` pulses at a time.
+            )",
+            py::arg("out"),
+            py::arg("out_geometry"),
+            py::arg("in"),
+            py::arg("in_geometry"),
+            py::arg("dem"),
+            py::arg("fc"),
+            py::arg("ds"),
+            py::arg("kernel"),
+            py::arg("dry_tropo_model") = "tsx",
+            py::arg("rdr2geo_params") = py::dict(),
+            py::arg("geo2rdr_params") = py::dict(),
+            py::arg("tile_params") = py::dict());
+
+    m.def("backproject", [](
+                py::array_t<std::complex<float>, py::array::c_style> out,
+                const RadarGeometry& out_geometry,
+                Raster& in,
+                const RadarGeometry& in_geometry,
+                const DEMInterpolator& dem,
+                double fc,
+                double ds,
+                const Kernel<float>& kernel,
+                const std::string& dry_tropo_model,
+                py::dict rdr2geo_params,
+                py::dict geo2rdr_params,
+                py::dict tile_params) {
+
+            if (out.ndim() != 2) {
+                throw InvalidArgument(ISCE_SRCINFO(), "output array must be 2-D");
+            }
+
+            if (out.shape()[0] != out_geometry.gridLength() or
+                out.shape()[1] != out_geometry.gridWidth()) {
+
+                std::string errmsg = "output array shape must match output "
+                    "radar grid shape";
+                throw InvalidArgument(ISCE_SRCINFO(), errmsg);
+            }
+
+            DryTroposphereModel atm = parseDryTropoModel(dry_tropo_model);
+            Rdr2GeoParams r2gparams = parseRdr2GeoParams(rdr2geo_params);
+            Geo2RdrParams g2rparams = parseGeo2RdrParams(geo2rdr_params);
+            TileParams tparams = parseTileParams(tile_params);
+
+            backproject(out.mutable_data(), out_geometry, in, in_geometry, dem,
+                    fc, ds, kernel, atm, r2gparams, g2rparams, tparams);
+            },
+            R"(
+                Focus in azimuth via time-domain backprojection, streaming
+                range-compressed signal data from a raster so that only the
+                pulses needed by the current block of output lines are held
+                in memory.
             )",
             py::arg("out"),
             py::arg("out_geometry"),
@@ -99,5 +192,6 @@ void addbinding_backproject(py::module& m)
             py::arg("kernel"),
             py::arg("dry_tropo_model") = "tsx",
             py::arg("rdr2geo_params") = py::dict(),
-            py::arg("geo2rdr_params") = py::dict());
+            py::arg("geo2rdr_params") = py::dict(),
+            py::arg("tile_params") = py::dict());
 }
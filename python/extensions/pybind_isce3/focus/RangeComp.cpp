@@ -33,52 +33,63 @@ void addbinding(pybind11::enum_<RangeComp::Mode> & pyMode)
         )");
 }
 
+template<typename Out, typename In>
+static int getBatchSize(const RangeComp & self, const Out & out, const In & in)
+{
+    if (in.ndim() != out.ndim())
+        throw std::length_error("require same ndim on input and output");
+    int batch = 1;
+    // XXX C++ method doesn't do any size/shape checks.
+    // Require 2D with matching slow dim if batched operation.
+    if (in.ndim() == 2) {
+        batch = in.shape(0);
+        if (in.shape(0) != out.shape(0))
+            throw std::length_error(
+                "require equal batch size on input and output");
+        if (in.shape(1) != self.inputSize())
+            throw std::length_error("unexpected input length");
+        if (out.shape(1) != self.outputSize())
+            throw std::length_error("unexpected output length");
+    } else if (in.ndim() == 1) {
+        if (in.shape(0) != self.inputSize())
+            throw std::length_error("unexpected input length");
+        if (out.shape(0) != self.outputSize())
+            throw std::length_error("unexpected output length");
+    } else {
+        throw std::invalid_argument("require 1D or 2D data");
+    }
+    return batch;
+}
+
 void addbinding(py::class_<RangeComp>& pyRangeComp)
 {
     using T = std::complex<float>;
     using chirp_t = std::vector<T>;
     using buf_t = py::array_t<T, py::array::c_style>;
+    using realbuf_t = py::array_t<float, py::array::c_style>;
 
     pyRangeComp
-        .def(py::init<const chirp_t &, int, int, RangeComp::Mode>(),
+        .def(py::init<const chirp_t &, int, int, RangeComp::Mode, int, bool>(),
             py::arg("chirp"), py::arg("inputsize"),
             py::arg("maxbatch") = 1, py::arg("mode") = RangeComp::Mode::Full,
+            py::arg("decimation") = 1, py::arg("real_input") = false,
             R"(
     Forms a matched filter from the time-reversed complex conjugate of the
     chirp replica and creates FFT plans for frequency domain convolution
     with the matched filter.
 
-    chirp     Time-domain replica of the transmitted chirp waveform
-    inputsize Number of range samples in the signal to be compressed
-    maxbatch  Max batch size
-    mode      Convolution output mode
+    chirp      Time-domain replica of the transmitted chirp waveform
+    inputsize  Number of range samples in the signal to be compressed
+    maxbatch   Max batch size
+    mode       Convolution output mode
+    decimation Output decimation factor. The matched filter spectrum is
+               cropped to the decimated bandwidth.
+    real_input Expect real-valued offset video input with carrier at fs/4
             )")
 
         .def("rangecompress",
             [](RangeComp & self, buf_t & out, const buf_t & in) {
-                if (in.ndim() != out.ndim())
-                    throw std::length_error(
-                        "require same ndim on input and output");
-                int batch = 1;
-                // XXX C++ method doesn't do any size/shape checks.
-                // Require 2D with matching slow dim if batched operation.
-                if (in.ndim() == 2) {
-                    batch = in.shape(0);
-                    if (in.shape(0) != out.shape(0))
-                        throw std::length_error(
-                            "require equal batch size on input and output");
-                    if (in.shape(1) != self.inputSize())
-                        throw std::length_error("unexpected input length");
-                    if (out.shape(1) != self.outputSize())
-                        throw std::length_error("unexpected output length");
-                } else if (in.ndim() == 1) {
-                    if (in.shape(0) != self.inputSize())
-                        throw std::length_error("unexpected input length");
-                    if (out.shape(0) != self.outputSize())
-                        throw std::length_error("unexpected output length");
-                } else {
-                    throw std::invalid_argument("require 1D or 2D data");
-                }
+                int batch = getBatchSize(self, out, in);
                 self.rangecompress(out.mutable_data(), in.data(), batch);
             }, py::arg("out"), py::arg("in"), R"(
     Perform pulse compression on a batch of input signals
@@ -87,13 +98,79 @@ void addbinding(py::class_<RangeComp>& pyRangeComp)
     function.  Batch size inferred from first dimension of 2D data (1 for 1D).
             )")
 
+        .def("rangecompress",
+            [](RangeComp & self, buf_t & out, const realbuf_t & in) {
+                int batch = getBatchSize(self, out, in);
+                self.rangecompress(out.mutable_data(), in.data(), batch);
+            }, py::arg("out"), py::arg("in"), R"(
+    Perform pulse compression on a batch of real-valued input signals
+
+    Requires a processor constructed with real_input=True.  Batch size
+    inferred from first dimension of 2D data (1 for 1D).
+            )")
+
         .def_property_readonly("chirp_size", &RangeComp::chirpSize)
         .def_property_readonly("input_size", &RangeComp::inputSize)
         .def_property_readonly("fft_size", &RangeComp::fftSize)
         // one word for symmetry with ctor argument
         .def_property_readonly("maxbatch", &RangeComp::maxBatch)
         .def_property_readonly("mode", &RangeComp::mode)
+        .def_property_readonly("decimation", &RangeComp::decimation)
+        .def_property_readonly("real_input", &RangeComp::realInput)
         .def_property_readonly("output_size", &RangeComp::outputSize)
         .def_property_readonly("first_valid_sample", &RangeComp::firstValidSample)
         ;
 }
+
+void addbinding(py::class_<ParallelRangeComp>& pyRangeComp)
+{
+    using T = std::complex<float>;
+    using chirp_t = std::vector<T>;
+    using buf_t = py::array_t<T, py::array::c_style>;
+
+    pyRangeComp
+        .def(py::init<const chirp_t &, int, int, RangeComp::Mode, int, int>(),
+            py::arg("chirp"), py::arg("inputsize"), py::arg("batch") = 16,
+            py::arg("mode") = RangeComp::Mode::Full,
+            py::arg("decimation") = 1, py::arg("threads") = -1,
+            R"(
+    Multi-threaded range compression processor with per-thread FFT plans and
+    workspaces.
+
+    chirp      Time-domain replica of the transmitted chirp waveform
+    inputsize  Number of range samples in the signal to be compressed
+    batch      Number of pulses processed per thread at a time
+    mode       Convolution output mode
+    decimation Output decimation factor. The matched filter spectrum is
+               cropped to the decimated bandwidth.
+    threads    Number of threads (defaults to max OpenMP threads)
+            )")
+
+        .def("rangecompress",
+            [](ParallelRangeComp & self, buf_t & out, const buf_t & in) {
+                if (in.ndim() != 2 or out.ndim() != 2)
+                    throw std::invalid_argument("require 2D data");
+                if (in.shape(0) != out.shape(0))
+                    throw std::length_error(
+                        "require equal number of pulses on input and output");
+                if (in.shape(1) != self.inputSize())
+                    throw std::length_error("unexpected input length");
+                if (out.shape(1) != self.outputSize())
+                    throw std::length_error("unexpected output length");
+                self.rangecompress(out.mutable_data(), in.data(), in.shape(0));
+            }, py::arg("out"), py::arg("in"), R"(
+    Perform pulse compression on a block of input signals, distributing
+    batches of pulses among threads.
+            )")
+
+        .def_property_readonly("chirp_size", &ParallelRangeComp::chirpSize)
+        .def_property_readonly("input_size", &ParallelRangeComp::inputSize)
+        .def_property_readonly("fft_size", &ParallelRangeComp::fftSize)
+        .def_property_readonly("batch", &ParallelRangeComp::batchSize)
+        .def_property_readonly("mode", &ParallelRangeComp::mode)
+        .def_property_readonly("decimation", &ParallelRangeComp::decimation)
+        .def_property_readonly("threads", &ParallelRangeComp::threads)
+        .def_property_readonly("output_size", &ParallelRangeComp::outputSize)
+        .def_property_readonly("first_valid_sample", &ParallelRangeComp::firstValidSample)
+        ;
+}
@@ -5,3 +5,4 @@
 
 void addbinding(pybind11::enum_<isce3::focus::RangeComp::Mode>&);
 void addbinding(pybind11::class_<isce3::focus::RangeComp>&);
+void addbinding(pybind11::class_<isce3::focus::ParallelRangeComp>&);
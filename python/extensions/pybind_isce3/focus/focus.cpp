@@ -16,6 +16,7 @@ void addsubmodule_focus(py::module & m)
 
     py::class_<isce3::focus::RangeComp> pyRangeComp(m_focus, "RangeComp");
     py::enum_<isce3::focus::RangeComp::Mode> pyMode(pyRangeComp, "Mode");
+    py::class_<isce3::focus::ParallelRangeComp> pyParallelRangeComp(m_focus, "ParallelRangeComp");
 
     // add bindings
     addbinding(pyDryTropoModel);
@@ -24,4 +25,5 @@ void addsubmodule_focus(py::module & m)
     addbinding_backproject(m_focus);
     addbinding_chirp(m_focus);
     addbinding(pyRangeComp);
+    addbinding(pyParallelRangeComp);
 }
@@ -7,13 +7,30 @@
 #include <isce3/product/RadarGridParameters.h>
 #include <isce3/product/GeoGridParameters.h>
 
+#include <pybind11/stl.h>
+
 #include <isce3/geocode/geocodeSlc.h>
 
 namespace py = pybind11;
 
 void addbinding_geocodeslc(py::module & m)
 {
-    m.def("geocode_slc", &isce3::geocode::geocodeSlc,
+    using isce3::core::Ellipsoid;
+    using isce3::core::LUT2d;
+    using isce3::core::Orbit;
+    using isce3::geometry::geocodeBlockTraversal;
+    using isce3::io::Raster;
+    using isce3::product::GeoGridParameters;
+    using isce3::product::RadarGridParameters;
+
+    m.def("geocode_slc", py::overload_cast<Raster &, Raster &, Raster &,
+                const RadarGridParameters &, const GeoGridParameters &,
+                const Orbit &, const LUT2d<double> &, const LUT2d<double> &,
+                const Ellipsoid &, const double &, const int &,
+                const size_t &, const double &, const bool,
+                const std::vector<int> &, const std::string &,
+                const geocodeBlockTraversal>(
+                &isce3::geocode::geocodeSlc),
         py::arg("output_raster"),
         py::arg("input_raster"),
         py::arg("dem_raster"),
@@ -27,5 +44,44 @@ void addbinding_geocodeslc(py::module & m)
         py::arg("numiter_geo2rdr") = 25,
         py::arg("lines_per_block") = 1000,
         py::arg("dem_block_margin") = 0.1,
-        py::arg("flatten") = true);
+        py::arg("flatten") = true,
+        py::arg("overview_factors") = std::vector<int>{},
+        py::arg("overview_resampling") = "NEAREST",
+        py::arg("block_traversal") = isce3::geometry::BLOCKS_OF_LINES);
+
+    m.def("geocode_slc", py::overload_cast<const std::vector<Raster *> &,
+                const std::vector<Raster *> &, Raster &,
+                const RadarGridParameters &, const GeoGridParameters &,
+                const Orbit &, const LUT2d<double> &, const LUT2d<double> &,
+                const Ellipsoid &, const double &, const int &,
+                const size_t &, const double &, const bool,
+                const std::vector<int> &, const std::string &,
+                const geocodeBlockTraversal>(
+                &isce3::geocode::geocodeSlc),
+        py::arg("output_rasters"),
+        py::arg("input_rasters"),
+        py::arg("dem_raster"),
+        py::arg("radargrid"),
+        py::arg("geogrid"),
+        py::arg("orbit"),
+        py::arg("native_doppler"),
+        py::arg("image_grid_doppler"),
+        py::arg("ellipsoid"),
+        py::arg("threshold_geo2rdr") = 1.0e-9,
+        py::arg("numiter_geo2rdr") = 25,
+        py::arg("lines_per_block") = 1000,
+        py::arg("dem_block_margin") = 0.1,
+        py::arg("flatten") = true,
+        py::arg("overview_factors") = std::vector<int>{},
+        py::arg("overview_resampling") = "NEAREST",
+        py::arg("block_traversal") = isce3::geometry::BLOCKS_OF_LINES);
+
+    m.def("geocode_slc_lines_per_block", &isce3::geocode::geocodeSlcLinesPerBlock,
+        py::arg("dem_raster"),
+        py::arg("radargrid"),
+        py::arg("geogrid"),
+        py::arg("dem_block_margin"),
+        py::arg("memory_budget"),
+        R"(Number of lines per block of geocode_slc whose predicted peak
+        memory fits in memory_budget (bytes))");
 }
@@ -0,0 +1,24 @@
+#include "DEMTileCache.h"
+
+namespace py = pybind11;
+
+using isce3::geometry::DEMTileCache;
+
+void addbinding(pybind11::class_<DEMTileCache> & pyDEMTileCache)
+{
+    pyDEMTileCache
+        .def_static("instance", &DEMTileCache::instance,
+            py::return_value_policy::reference,
+            "Cache of DEM tiles shared by the whole process")
+        .def_property("memory_budget",
+            py::overload_cast<>(&DEMTileCache::memoryBudget, py::const_),
+            py::overload_cast<size_t>(&DEMTileCache::memoryBudget),
+            "Maximum memory held by the tiles (bytes). 0 disables caching.")
+        .def_property_readonly("tile_size", &DEMTileCache::tileSize)
+        .def_property_readonly("memory_usage", &DEMTileCache::memoryUsage)
+        .def_property_readonly("hits", &DEMTileCache::hits)
+        .def_property_readonly("misses", &DEMTileCache::misses)
+        .def("clear", &DEMTileCache::clear,
+            "Drop all tiles and reset the statistics")
+        ;
+}
@@ -5,10 +5,12 @@
 #include <isce3/io/Raster.h>
 
 #include <limits>
+#include <pybind11/stl.h>
 
 namespace py = pybind11;
 
 using isce3::geometry::Geocode;
+using isce3::geometry::geocodeBlockTraversal;
 using isce3::geometry::geocodeMemoryMode;
 using isce3::geometry::geocodeOutputMode;
 using isce3::geometry::rtcInputRadiometry;
@@ -27,9 +29,15 @@ void addbinding(py::class_<Geocode<T>> &pyGeocode)
         .def_property("ellipsoid", nullptr, &Geocode<T>::ellipsoid)
         .def_property("threshold_geo2rdr", nullptr, &Geocode<T>::thresholdGeo2rdr)
         .def_property("num_iter_geo2rdr", nullptr, &Geocode<T>::numiterGeo2rdr)
-        .def_property("lines_per_block", nullptr, &Geocode<T>::linesPerBlock)
+        .def_property("lines_per_block", nullptr,
+                py::overload_cast<size_t>(&Geocode<T>::linesPerBlock))
+        .def_property("memory_budget", nullptr, &Geocode<T>::memoryBudget)
         .def_property("dem_block_margin", nullptr, &Geocode<T>::demBlockMargin)
         .def_property("radar_block_margin", nullptr, &Geocode<T>::radarBlockMargin)
+        .def_property("block_traversal", nullptr, &Geocode<T>::blockTraversal)
+        .def("overviews", &Geocode<T>::overviews,
+            py::arg("factors"),
+            py::arg("resampling") = "AVERAGE")
         .def_property("interpolator",
                 nullptr,
                 [](Geocode<T> & self, std::string & method)
@@ -46,6 +54,11 @@ void addbinding(py::class_<Geocode<T>> &pyGeocode)
         .def_property_readonly("geogrid_spacing_y", &Geocode<T>::geoGridSpacingY)
         .def_property_readonly("geogrid_width", &Geocode<T>::geoGridWidth)
         .def_property_readonly("geogrid_length", &Geocode<T>::geoGridLength)
+        .def("peak_memory", &Geocode<T>::peakMemory,
+            py::arg("radar_grid"),
+            py::arg("input_raster"),
+            py::arg("output_raster"),
+            py::arg("dem_raster"))
         .def("update_geogrid", &Geocode<T>::updateGeoGrid,
             py::arg("radar_grid"),
             py::arg("dem_raster"))
@@ -145,6 +158,14 @@ void addbinding(pybind11::enum_<geocodeMemoryMode> & pyGeocodeMemoryMode)
         ;
 };
 
+void addbinding(pybind11::enum_<geocodeBlockTraversal> & pyGeocodeBlockTraversal)
+{
+    pyGeocodeBlockTraversal
+        .value("BLOCKS_OF_LINES", geocodeBlockTraversal::BLOCKS_OF_LINES)
+        .value("HILBERT_TILES", geocodeBlockTraversal::HILBERT_TILES)
+        ;
+};
+
 template void addbinding(py::class_<Geocode<float>> &);
 template void addbinding(py::class_<Geocode<double>> &);
 template void addbinding(py::class_<Geocode<std::complex<float>>> &);
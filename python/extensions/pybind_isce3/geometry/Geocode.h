@@ -7,3 +7,4 @@ template<typename T>
 void addbinding(pybind11::class_<isce3::geometry::Geocode<T>>&);
 void addbinding(pybind11::enum_<isce3::geometry::geocodeMemoryMode> &);
 void addbinding(pybind11::enum_<isce3::geometry::geocodeOutputMode> &);
+void addbinding(pybind11::enum_<isce3::geometry::geocodeBlockTraversal> &);
@@ -2,6 +2,7 @@
 
 #include "boundingbox.h"
 #include "DEMInterpolator.h"
+#include "DEMTileCache.h"
 #include "Geocode.h"
 #include "geo2rdr.h"
 #include "rdr2geo.h"
@@ -16,6 +17,8 @@ void addsubmodule_geometry(py::module & m)
     // forward declare bound classes
     py::class_<isce3::geometry::DEMInterpolator>
         pyDEMInterpolator(geometry, "DEMInterpolator");
+    py::class_<isce3::geometry::DEMTileCache>
+        pyDEMTileCache(geometry, "DEMTileCache");
     py::class_<isce3::geometry::Geocode<float>>
         pyGeocodeFloat32(geometry, "GeocodeFloat32");
     py::class_<isce3::geometry::Geocode<double>>
@@ -34,6 +37,8 @@ void addsubmodule_geometry(py::module & m)
         pyGeocodeMemoryMode(geometry, "GeocodeMemoryMode");
     py::enum_<isce3::geometry::geocodeOutputMode>
         pyGeocodeOutputMode(geometry, "GeocodeOutputMode");
+    py::enum_<isce3::geometry::geocodeBlockTraversal>
+        pyGeocodeBlockTraversal(geometry, "GeocodeBlockTraversal");
     py::enum_<isce3::geometry::rtcInputRadiometry>
         pyInputRadiometry(geometry, "RtcInputRadiometry");
     py::enum_<isce3::geometry::rtcAlgorithm>
@@ -41,6 +46,7 @@ void addsubmodule_geometry(py::module & m)
 
     // add bindings
     addbinding(pyDEMInterpolator);
+    addbinding(pyDEMTileCache);
     addbinding(pyGeocodeFloat32);
     addbinding(pyGeocodeFloat64);
     addbinding(pyGeocodeCFloat32);
@@ -49,6 +55,7 @@ void addsubmodule_geometry(py::module & m)
     addbinding(pyRdr2Geo);
     addbinding(pyGeocodeMemoryMode);
     addbinding(pyGeocodeOutputMode);
+    addbinding(pyGeocodeBlockTraversal);
     addbinding(pyInputRadiometry);
     addbinding(pyRtcAlgorithm);
     addbinding_rdr2geo(geometry);
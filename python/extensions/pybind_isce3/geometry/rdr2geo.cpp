@@ -135,5 +135,14 @@ void addbinding(py::class_<Topo> & pyRdr2Geo)
         .def_property("compute_mask",
                 py::overload_cast<>(&Topo::computeMask, py::const_),
                 py::overload_cast<bool>(&Topo::computeMask))
+        .def_property("lines_per_block",
+                py::overload_cast<>(&Topo::linesPerBlock, py::const_),
+                py::overload_cast<size_t>(&Topo::linesPerBlock))
+        .def_property("memory_budget",
+                py::overload_cast<>(&Topo::memoryBudget, py::const_),
+                py::overload_cast<size_t>(&Topo::memoryBudget),
+                "Memory budget setting the number of lines per block (bytes), 0 to use lines_per_block")
+        .def("peak_memory", &Topo::peakMemory, py::arg("dem_raster"),
+                "Predicted peak memory of topo with a DEM raster (bytes)")
         ;
 }
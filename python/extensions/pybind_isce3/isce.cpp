@@ -18,8 +18,9 @@ PYBIND11_MODULE(pybind_isce3, m) {
     m.doc() = "InSAR Scientific Computing Environment (ISCE)";
 
     addsubmodule_core(m);
-    addsubmodule_geocode(m);
     addsubmodule_geometry(m);
+    // after geometry, whose enums are used as default arguments
+    addsubmodule_geocode(m);
     addsubmodule_image(m);
     addsubmodule_io(m);
     addsubmodule_signal(m);
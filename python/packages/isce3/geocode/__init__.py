@@ -1,4 +1,4 @@
 #-*- coding: utf-8 -*-
 
-from .geocodeSlc import geocodeSlc
+from .geocodeSlc import geocodeSlc, geocodeSlcLinesPerBlock
 
@@ -15,7 +15,23 @@ def geocodeSlc(gslc_raster, slc_raster, dem_raster,
         
     """
     Wrapper for pygeocodeSlc function.
+
+    gslc_raster and slc_raster may also be lists of rasters sharing the
+    same radar grid (e.g. the polarizations of a frequency), which are
+    geocoded in a single pass.
     """
+    if isinstance(slc_raster, (list, tuple)):
+        isceextension.pygeocodeSlcRasters(list(gslc_raster), list(slc_raster),
+                      dem_raster,
+                      radar_grid, geo_grid,
+                      orbit,
+                      native_doppler, image_grid_doppler,
+                      ellipsoid,
+                      thresholdGeo2rdr, numiterGeo2rdr,
+                      linesPerBlock, demBlockMargin,
+                      flatten)
+        return None
+
     isceextension.pygeocodeSlc(gslc_raster, slc_raster, dem_raster,
                       radar_grid, geo_grid,
                       orbit,
@@ -26,3 +42,13 @@ def geocodeSlc(gslc_raster, slc_raster, dem_raster,
                       flatten)
 
     return None
+
+def geocodeSlcLinesPerBlock(dem_raster, radar_grid, geo_grid,
+                            demBlockMargin, memoryBudget):
+    """
+    Number of lines per block of geocodeSlc whose predicted peak memory
+    fits in memoryBudget (bytes).
+    """
+    return isceextension.pygeocodeSlcLinesPerBlock(dem_raster,
+                      radar_grid, geo_grid,
+                      demBlockMargin, memoryBudget)
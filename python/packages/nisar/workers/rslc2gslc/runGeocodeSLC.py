@@ -33,67 +33,79 @@ def runGeocodeSLC(self):
         pol_list = state.subset_dict[freq]
         radar_grid = self.radar_grid_list[freq]
         geo_grid = self.geogrid_dict[frequency]
-        for polarization in pol_list: 
-            self._print(f'working on frequency: {freq}, polarization: {polarization}')
-            # get doppler centroid
-            native_doppler = slc.getDopplerCentroid(frequency=freq)
 
-            # Doppler of the image grid (Zero for NISAR)
-            image_grid_doppler = isce3.core.lut2d()
+        # get doppler centroid
+        native_doppler = slc.getDopplerCentroid(frequency=freq)
 
-            output_dir = os.path.dirname(os.path.abspath(self.state.output_hdf5))
-            os.makedirs(output_dir, exist_ok=True)
-            
+        # Doppler of the image grid (Zero for NISAR)
+        image_grid_doppler = isce3.core.lut2d()
+
+        output_dir = os.path.dirname(os.path.abspath(self.state.output_hdf5))
+        os.makedirs(output_dir, exist_ok=True)
+
+        # the polarizations of a frequency share the radar grid, so they
+        # are geocoded together in a single pass
+        dst_h5 = h5py.File(state.output_hdf5, 'a')
+        slc_rasters = []
+        gslc_rasters = []
+        for polarization in pol_list: 
+            self._print(f'working on frequency: {freq}, polarization: {polarization}')
             slc_dataset = self.slc_obj.getSlcDataset(freq, polarization)
-            slc_raster = isce3.io.raster(filename='', h5=slc_dataset)
+            slc_rasters.append(isce3.io.raster(filename='', h5=slc_dataset))
 
             # access the HDF5 dataset for a given frequency and polarization
-            dst_h5 = h5py.File(state.output_hdf5, 'a')
             dataset_path = f'science/LSAR/GSLC/grids/{frequency}/{polarization}'
             gslc_dataset = dst_h5[dataset_path]
 
             # Construct the output ratster directly from HDF5 dataset
-            gslc_raster = isce3.io.raster(filename='', h5=gslc_dataset, 
-                                access=gdal.GA_Update)
+            gslc_rasters.append(isce3.io.raster(filename='', h5=gslc_dataset, 
+                                access=gdal.GA_Update))
             
-            # This whole section requires better sanity check and handling defaults
-            threshold_geo2rdr = self.userconfig['runconfig']['groups']['processing']['geo2rdr']['threshold']
-            iteration_geo2rdr = self.userconfig['runconfig']['groups']['processing']['geo2rdr']['maxiter']
-            lines_per_block = self.userconfig['runconfig']['groups']['processing']['blocksize']['y']
-            dem_block_margin = self.userconfig['runconfig']['groups']['processing']['dem_margin']
-            flatten = self.userconfig['runconfig']['groups']['processing']['flatten']
-
-            # this may not be the best way. needs to be revised
-            if flatten:
-                self._print("flattening is True")
-            else:
-                self._print("flattening is False")
-
-            if np.isnan(threshold_geo2rdr):
-                threshold_geo2rdr = 1.0e-9
-
-            if np.isnan(iteration_geo2rdr):
-                iteration_geo2rdr = 25
-
-            if np.isnan(lines_per_block):
-                lines_per_block = 1000
-
-            if np.isnan(dem_block_margin):
-                dem_block_margin = 0.1
-
-            # run geocodeSlc : 
-            isce3.geocode.geocodeSlc(gslc_raster, slc_raster, dem_raster,
-                    radar_grid, geo_grid,
-                    orbit,
-                    native_doppler, image_grid_doppler,
-                    ellipsoid,
-                    threshold_geo2rdr, iteration_geo2rdr,
-                    lines_per_block, dem_block_margin,
-                    flatten)
-
-            # the rasters need to be deleted
-            del gslc_raster
-            del slc_raster
-
-            dst_h5.close()
-
+        # This whole section requires better sanity check and handling defaults
+        threshold_geo2rdr = self.userconfig['runconfig']['groups']['processing']['geo2rdr']['threshold']
+        iteration_geo2rdr = self.userconfig['runconfig']['groups']['processing']['geo2rdr']['maxiter']
+        lines_per_block = self.userconfig['runconfig']['groups']['processing']['blocksize']['y']
+        memory_budget = self.userconfig['runconfig']['groups']['processing'].get('memory_budget')
+        dem_block_margin = self.userconfig['runconfig']['groups']['processing']['dem_margin']
+        flatten = self.userconfig['runconfig']['groups']['processing']['flatten']
+
+        # this may not be the best way. needs to be revised
+        if flatten:
+            self._print("flattening is True")
+        else:
+            self._print("flattening is False")
+
+        if np.isnan(threshold_geo2rdr):
+            threshold_geo2rdr = 1.0e-9
+
+        if np.isnan(iteration_geo2rdr):
+            iteration_geo2rdr = 25
+
+        if np.isnan(lines_per_block):
+            lines_per_block = 1000
+
+        if np.isnan(dem_block_margin):
+            dem_block_margin = 0.1
+
+        # a memory budget (bytes) overrides the block size
+        if memory_budget is not None and memory_budget > 0:
+            lines_per_block = isce3.geocode.geocodeSlcLinesPerBlock(
+                    dem_raster, radar_grid, geo_grid,
+                    dem_block_margin, int(memory_budget))
+            self._print(f'lines per block for memory budget: {lines_per_block}')
+
+        # run geocodeSlc on all the polarizations: 
+        isce3.geocode.geocodeSlc(gslc_rasters, slc_rasters, dem_raster,
+                radar_grid, geo_grid,
+                orbit,
+                native_doppler, image_grid_doppler,
+                ellipsoid,
+                threshold_geo2rdr, iteration_geo2rdr,
+                lines_per_block, dem_block_margin,
+                flatten)
+
+        # the rasters need to be deleted
+        del gslc_rasters
+        del slc_rasters
+
+        dst_h5.close()
@@ -449,7 +449,7 @@ def focus(runconfig):
 
         rcmode = parse_rangecomp_mode(cfg.processing.rangecomp.mode)
         log.info(f"Preparing range compressor with {rcmode}")
-        rc = isce.focus.RangeComp(chirp, nr, maxbatch=na, mode=rcmode)
+        rc = isce.focus.ParallelRangeComp(chirp, nr, mode=rcmode)
 
         # Rangecomp modifies range grid.  Also update wavelength.
         rc_grid = raw_grid.copy()
@@ -29,9 +29,12 @@ focus/dry-troposphere-model.cpp
 focus/gaps.cpp
 focus/rangecomp.cpp
 geocode/geocodeSlc.cpp
+geometry/blockmemory/blockmemory.cpp
 geometry/dem/dem.cpp
+geometry/dem/demtilecache.cpp
 geometry/geo2rdr/geo2rdr.cpp
 geometry/geocode/geocode.cpp
+geometry/geocode/geogridblocks.cpp
 geometry/geometry/geometry_constlat.cpp
 geometry/geometry/geometry.cpp
 geometry/geometry/geometry_equator.cpp
@@ -45,14 +48,18 @@ io/gdal/geotransform.cpp
 io/gdal/spatialreference.cpp
 io/IH5/ih5castread.cpp
 io/IH5/ih5castwrite.cpp
+io/IH5/ih5chunkwriter.cpp
 io/IH5/ih5.cpp
 io/IH5/ih5gdal.cpp
 io/IH5/ih5nativeread.cpp
 io/IH5/ih5nativewrite.cpp
 io/raster/raster.cpp
+io/raster/rasterconcurrent.cpp
 io/raster/rasterepsg.cpp
 io/raster/rastermatrix.cpp
+io/raster/rasteroverview.cpp
 io/raster/rasterview.cpp
+io/raster/slidingwindowcache.cpp
 matchtemplate/ampcor/ampcor.cpp
 math/bessel/bessel53.cpp
 math/sinc.cpp
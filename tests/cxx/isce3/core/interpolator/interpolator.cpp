@@ -12,6 +12,7 @@
 #include <sstream>
 #include <iostream>
 #include <complex>
+#include <memory>
 #include <vector>
 #include "gtest/gtest.h"
 
@@ -383,6 +384,54 @@ TEST_F(InterpolatorTest, Sinc2dComplex) {
     delete interp;
 }
 
+// Test sinc interpolation of the samples for the kernel lengths with a fixed
+// length evaluation and another length
+TEST_F(InterpolatorTest, Sinc2dKernelLengths) {
+    for (int sincLen : {8, 16, 10}) {
+        isce3::core::Sinc2dInterpolator<std::complex<double>> interp(
+            sincLen, isce3::core::SINC_SUB);
+        for (size_t i = sincLen; i < M_cpx.length() - sincLen; i += 3) {
+            for (size_t j = sincLen; j < M_cpx.width() - sincLen; j += 3) {
+                const auto z = interp.interpolate(j, i, M_cpx);
+                ASSERT_NEAR(z.real(), M_cpx(i,j).real(), 1.0e-8);
+                ASSERT_NEAR(z.imag(), M_cpx(i,j).imag(), 1.0e-8);
+            }
+        }
+    }
+}
+
+// Test batch interpolation against interpolation one point at a time
+TEST_F(InterpolatorTest, Batch) {
+    // Test points away from the edges of the data
+    std::vector<double> x, y;
+    for (size_t i = 0; i < true_values.length(); ++i) {
+        const double xi = (true_values(i,0) - start) / delta;
+        const double yi = (true_values(i,1) - start) / delta;
+        if (xi < 5 or yi < 5 or xi >= M.width() - 6 or yi >= M.length() - 6) {
+            continue;
+        }
+        x.push_back(xi);
+        y.push_back(yi);
+    }
+    ASSERT_GT(x.size(), 0);
+
+    for (auto method : {isce3::core::NEAREST_METHOD,
+                        isce3::core::BILINEAR_METHOD,
+                        isce3::core::BICUBIC_METHOD,
+                        isce3::core::BIQUINTIC_METHOD,
+                        isce3::core::SINC_METHOD}) {
+        std::unique_ptr<isce3::core::Interpolator<std::complex<double>>> interp(
+            isce3::core::createInterpolator<std::complex<double>>(method));
+        std::vector<std::complex<double>> z(x.size());
+        interp->interpolate(x.data(), y.data(), x.size(), M_cpx, z.data());
+        for (size_t i = 0; i < x.size(); ++i) {
+            const auto zref = interp->interpolate(x[i], y[i], M_cpx);
+            ASSERT_NEAR(z[i].real(), zref.real(), 1.0e-12);
+            ASSERT_NEAR(z[i].imag(), zref.imag(), 1.0e-12);
+        }
+    }
+}
+
 TEST_F(InterpolatorTest, SimpleRampTest) {
 
     // This test creates a matrix of data whose values form a 
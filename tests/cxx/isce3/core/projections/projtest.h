@@ -20,6 +20,23 @@ auto projTest(const ProjectionBase& p, const Vec3& ref_llh,
     EXPECT_NEAR(llh[0], ref_llh[0], 1e-9);
     EXPECT_NEAR(llh[1], ref_llh[1], 1e-9);
     EXPECT_NEAR(llh[2], ref_llh[2], 1e-6);
+
+    // Batch transforms match the point transforms
+    const double lon[] = {ref_llh[0], llh[0]}, lat[] = {ref_llh[1], llh[1]},
+                 hgt[] = {ref_llh[2], llh[2]};
+    double x[2], y[2], z[2];
+    EXPECT_EQ(p.forward(lon, lat, hgt, x, y, z, 2), 0);
+    EXPECT_EQ(x[0], xyz[0]);
+    EXPECT_EQ(y[0], xyz[1]);
+    EXPECT_EQ(z[0], xyz[2]);
+
+    double blon[2], blat[2], bhgt[2];
+    EXPECT_EQ(p.inverse(x, y, z, blon, blat, bhgt, 2), 0);
+    Vec3 back;
+    p.inverse(xyz, back);
+    EXPECT_EQ(blon[0], back[0]);
+    EXPECT_EQ(blat[0], back[1]);
+    EXPECT_EQ(bhgt[0], back[2]);
 }
 
 #define PROJ_TEST(testclass, proj, name, ...)            \
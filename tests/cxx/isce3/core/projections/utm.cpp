@@ -1,3 +1,5 @@
+#include <cmath>
+#include <vector>
 #include <gtest/gtest.h>
 #include <isce3/core/Projections.h>
 #include "projtest.h"
@@ -518,6 +520,51 @@ utmSouthTest(59, { 2.959352714231888e+00, -1.074158844609437e+00, 1.991679650882
 utmSouthTest(60, { 3.038341419519374e+00, -8.883583150753551e-01, 1.479453617383727e+03},
         {  2.949702298669473e+05,   4.357336082772384e+06, 1.479453617383727e+03});
 
+TEST(UTMBatchTest, ProjTransform) {
+    // Points of zone 11N and their transforms to zone 12N and to lon/lat
+    const size_t n = 100;
+    std::vector<double> x(n), y(n), z(n);
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = 300000. + 3000. * i;
+        y[i] = 3500000. + 5000. * i;
+        z[i] = 10. * i;
+    }
+
+    UTM utm11(32611), utm12(32612);
+    isce3::core::LonLat lonlat;
+    std::vector<double> xout(n), yout(n), zout(n);
+    ASSERT_EQ(isce3::core::projTransform(&utm11, &utm12, x.data(), y.data(),
+              z.data(), xout.data(), yout.data(), zout.data(), n), 0);
+    for (size_t i = 0; i < n; ++i) {
+        Vec3 out;
+        isce3::core::projTransform(&utm11, &utm12, {x[i], y[i], z[i]}, out);
+        EXPECT_EQ(xout[i], out[0]);
+        EXPECT_EQ(yout[i], out[1]);
+        EXPECT_EQ(zout[i], out[2]);
+    }
+
+    ASSERT_EQ(isce3::core::projTransform(&utm11, &lonlat, x.data(), y.data(),
+              z.data(), xout.data(), yout.data(), zout.data(), n), 0);
+    Vec3 out;
+    isce3::core::projTransform(&utm11, &lonlat, {x[0], y[0], z[0]}, out);
+    EXPECT_EQ(xout[0], out[0]);
+    EXPECT_EQ(yout[0], out[1]);
+
+    // Points too far from the central meridian are not transformed
+    x[n - 1] = 1.e8;
+    ASSERT_EQ(utm11.inverse(x.data(), y.data(), z.data(), xout.data(),
+                            yout.data(), zout.data(), n), 1);
+    EXPECT_TRUE(std::isnan(xout[n - 1]));
+    EXPECT_FALSE(std::isnan(xout[n - 2]));
+
+    // and are counted once, although the forward transform of the NaN
+    // result of the inverse fails too
+    ASSERT_EQ(isce3::core::projTransform(&utm11, &utm12, x.data(), y.data(),
+              z.data(), xout.data(), yout.data(), zout.data(), n), 1);
+    EXPECT_TRUE(std::isnan(xout[n - 1]));
+    EXPECT_FALSE(std::isnan(xout[n - 2]));
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -1,5 +1,7 @@
+#include <complex>
 #include <gtest/gtest.h>
 #include <isce3/focus/GapMask.h>
+#include <vector>
 
 TEST(GapDetectionTest, Mask)
 {
@@ -22,6 +24,47 @@ TEST(GapDetectionTest, Mask)
     }
 }
 
+TEST(GapDetectionTest, Block)
+{
+    // Staggered PRI with a guard band so the number of gaps varies by pulse.
+    int m = 50;
+    std::vector<double> t(m);
+    for (int i = 1; i < m; ++i) {
+        t[i] = t[i - 1] + ((i % 3 == 0) ? 2.5 : 2.0);
+    }
+    int n = 12;
+    isce3::focus::GapMask masker(t, n, 10.0, 1.0, 1.0, 0.25);
+
+    int first = 5, npulses = 30;
+    std::vector<std::pair<int, int>> gaps;
+    std::vector<int> offsets;
+    masker.gaps(gaps, offsets, first, npulses);
+
+    ASSERT_EQ(offsets.size(), npulses + 1);
+    EXPECT_EQ(offsets[0], 0);
+    EXPECT_EQ(offsets[npulses], gaps.size());
+    for (int p = 0; p < npulses; ++p) {
+        auto expected = masker.gaps(first + p);
+        std::vector<std::pair<int, int>> block(gaps.begin() + offsets[p],
+                                               gaps.begin() + offsets[p + 1]);
+        EXPECT_EQ(block, expected);
+    }
+
+    // apply in place with stride longer than the range line
+    int stride = n + 3;
+    std::vector<std::complex<float>> data(npulses * stride, 1.0f);
+    masker.apply(data.data(), first, npulses, stride);
+    for (int p = 0; p < npulses; ++p) {
+        auto mask = masker.mask(first + p);
+        for (int i = 0; i < stride; ++i) {
+            bool blocked = (i < n) && mask[i];
+            EXPECT_EQ(data[p * stride + i], blocked ? 0.0f : 1.0f);
+        }
+    }
+
+    EXPECT_THROW(masker.gaps(gaps, offsets, m - 1, 2), std::exception);
+}
+
 int main(int argc, char * argv[])
 {
     testing::InitGoogleTest(&argc, argv);
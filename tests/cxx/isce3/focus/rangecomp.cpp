@@ -3,11 +3,15 @@
 #include <gtest/gtest.h>
 #include <stdexcept>
 
+#include <isce3/except/Error.h>
 #include <isce3/focus/Chirp.h>
+#include <isce3/focus/GapMask.h>
 #include <isce3/focus/RangeComp.h>
 #include <isce3/math/Sinc.h>
 
 using isce3::focus::formLinearChirp;
+using isce3::focus::GapMask;
+using isce3::focus::ParallelRangeComp;
 using isce3::focus::RangeComp;
 using isce3::math::sinc;
 
@@ -183,6 +187,192 @@ TEST(RangeCompTest, ConvolveMode)
     }
 }
 
+/** Point target echo of a chirp with bandwidth well below the sample rate */
+struct PointTargetEcho {
+    int inputsize = 200;
+    int delay = 40;
+    std::vector<std::complex<float>> chirp;
+    std::vector<std::complex<float>> echo;
+
+    PointTargetEcho()
+    {
+        double chirprate = 4e12;
+        double duration = 2e-6;
+        double samplerate = 48e6;
+        chirp = formLinearChirp(chirprate, duration, samplerate);
+
+        echo.resize(inputsize, 0.f);
+        std::copy(chirp.begin(), chirp.end(), echo.begin() + delay);
+    }
+};
+
+TEST(RangeCompTest, Decimation)
+{
+    PointTargetEcho target;
+    int decimation = 2;
+
+    for (auto mode : {RangeComp::Mode::Full, RangeComp::Mode::Valid, RangeComp::Mode::Same}) {
+        RangeComp full(target.chirp, target.inputsize, 1, mode);
+        RangeComp decimated(target.chirp, target.inputsize, 1, mode, decimation);
+
+        EXPECT_EQ(decimated.decimation(), decimation);
+        EXPECT_FALSE(decimated.realInput());
+        EXPECT_EQ(decimated.outputSize(), (full.outputSize() + decimation - 1) / decimation);
+        EXPECT_EQ(decimated.firstValidSample(), (full.firstValidSample() + decimation - 1) / decimation);
+
+        std::vector<std::complex<float>> y(full.outputSize());
+        full.rangecompress(y.data(), target.echo.data());
+
+        std::vector<std::complex<float>> z(decimated.outputSize());
+        decimated.rangecompress(z.data(), target.echo.data());
+
+        // band-limited signal should match every D-th full rate sample
+        std::vector<std::complex<float>> expected(z.size());
+        for (std::size_t i = 0; i < z.size(); ++i) {
+            expected[i] = y[i * decimation];
+        }
+
+        float peak = std::abs(*std::max_element(y.begin(), y.end(),
+                [](auto a, auto b) { return std::abs(a) < std::abs(b); }));
+        float mae = maxAbsError(z, expected);
+        EXPECT_LT(mae, 1e-2 * peak);
+    }
+}
+
+TEST(RangeCompTest, RealInput)
+{
+    PointTargetEcho target;
+    int decimation = 2;
+    auto mode = RangeComp::Mode::Full;
+
+    // real-valued offset video signal with carrier at fs/4
+    std::vector<float> echo(target.inputsize);
+    for (int i = 0; i < target.inputsize; ++i) {
+        std::complex<float> carrier = std::polar(1.f, float(0.5 * M_PI * i));
+        echo[i] = (target.echo[i] * carrier).real();
+    }
+
+    RangeComp complex(target.chirp, target.inputsize, 1, mode, decimation);
+    RangeComp real(target.chirp, target.inputsize, 1, mode, decimation, true);
+
+    EXPECT_TRUE(real.realInput());
+    EXPECT_EQ(real.outputSize(), complex.outputSize());
+    EXPECT_EQ(real.fftSize() % 4, 0);
+
+    std::vector<std::complex<float>> expected(complex.outputSize());
+    complex.rangecompress(expected.data(), target.echo.data());
+
+    std::vector<std::complex<float>> output(real.outputSize());
+    real.rangecompress(output.data(), echo.data());
+
+    float peak = std::abs(*std::max_element(expected.begin(), expected.end(),
+            [](auto a, auto b) { return std::abs(a) < std::abs(b); }));
+    float mae = maxAbsError(output, expected);
+    EXPECT_LT(mae, 1e-2 * peak);
+
+    // mismatched input type
+    EXPECT_THROW(real.rangecompress(output.data(), target.echo.data()),
+                 isce3::except::InvalidArgument);
+    EXPECT_THROW(complex.rangecompress(output.data(), echo.data()),
+                 isce3::except::InvalidArgument);
+}
+
+TEST(ParallelRangeCompTest, MatchesRangeComp)
+{
+    double chirprate = 1e12;
+    double duration = 20e-6;
+    double samplerate = 24e6;
+    std::vector<std::complex<float>> chirp = formLinearChirp(chirprate, duration, samplerate);
+
+    // number of pulses is not a multiple of the batch size
+    int inputsize = 1000;
+    int npulses = 37;
+    std::vector<std::complex<float>> input(std::size_t(npulses) * inputsize);
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        input[i] = {std::cos(0.1f * i), std::sin(0.37f * i)};
+    }
+
+    float errtol = 1e-5;
+
+    for (auto mode : {RangeComp::Mode::Full, RangeComp::Mode::Valid, RangeComp::Mode::Same}) {
+        RangeComp rcproc(chirp, inputsize, npulses, mode);
+        std::vector<std::complex<float>> expected(std::size_t(npulses) * rcproc.outputSize());
+        rcproc.rangecompress(expected.data(), input.data(), npulses);
+
+        ParallelRangeComp prcproc(chirp, inputsize, 8, mode, 1, 4);
+        EXPECT_EQ(prcproc.outputSize(), rcproc.outputSize());
+        EXPECT_EQ(prcproc.firstValidSample(), rcproc.firstValidSample());
+        EXPECT_EQ(prcproc.threads(), 4);
+
+        std::vector<std::complex<float>> output(expected.size());
+        prcproc.rangecompress(output.data(), input.data(), npulses);
+
+        float mae = maxAbsError(output, expected);
+        EXPECT_LT(mae, errtol);
+    }
+}
+
+TEST(ParallelRangeCompTest, Decimation)
+{
+    // decimation crops the spectrum like RangeComp, rather than subsampling
+    PointTargetEcho target;
+    int npulses = 5;
+    std::vector<std::complex<float>> input;
+    for (int p = 0; p < npulses; ++p) {
+        input.insert(input.end(), target.echo.begin(), target.echo.end());
+    }
+
+    for (int decimation : {2, 3}) {
+        for (auto mode : {RangeComp::Mode::Full, RangeComp::Mode::Valid, RangeComp::Mode::Same}) {
+            RangeComp rcproc(target.chirp, target.inputsize, npulses, mode, decimation);
+            std::vector<std::complex<float>> expected(std::size_t(npulses) * rcproc.outputSize());
+            rcproc.rangecompress(expected.data(), input.data(), npulses);
+
+            ParallelRangeComp prcproc(target.chirp, target.inputsize, 2, mode, decimation, 2);
+            EXPECT_EQ(prcproc.decimation(), decimation);
+            EXPECT_EQ(prcproc.fftSize(), rcproc.fftSize());
+            EXPECT_EQ(prcproc.outputSize(), rcproc.outputSize());
+            EXPECT_EQ(prcproc.firstValidSample(), rcproc.firstValidSample());
+
+            std::vector<std::complex<float>> output(expected.size());
+            prcproc.rangecompress(output.data(), input.data(), npulses);
+
+            float peak = std::abs(*std::max_element(expected.begin(), expected.end(),
+                    [](auto a, auto b) { return std::abs(a) < std::abs(b); }));
+            float mae = maxAbsError(output, expected);
+            EXPECT_LT(mae, 1e-5 * peak);
+        }
+    }
+}
+
+TEST(ParallelRangeCompTest, GapMask)
+{
+    // Send a 1 s pulse every 2 s so that even samples are blocked (see gaps.cpp)
+    int npulses = 4;
+    std::vector<double> t(npulses + 10);
+    for (std::size_t i = 0; i < t.size(); ++i) {
+        t[i] = 2.0 * i;
+    }
+    int inputsize = 10;
+    GapMask gapmask(t, inputsize, 10.0, 1.0, 1.0);
+
+    // identity filter so that output equals masked input
+    std::vector<std::complex<float>> chirp = {1.};
+    std::vector<std::complex<float>> input(npulses * inputsize, 1.);
+
+    ParallelRangeComp rcproc(chirp, inputsize, 3, RangeComp::Mode::Full);
+    std::vector<std::complex<float>> output(npulses * rcproc.outputSize());
+    rcproc.rangecompress(output.data(), input.data(), npulses, gapmask, 0);
+
+    for (int p = 0; p < npulses; ++p) {
+        auto mask = gapmask.mask(p);
+        for (int i = 0; i < inputsize; ++i) {
+            float expected = mask[i] ? 0.f : 1.f;
+            EXPECT_NEAR(std::abs(output[p * inputsize + i]), expected, 1e-6);
+        }
+    }
+}
+
 int main(int argc, char * argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -3,7 +3,10 @@
 #include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <sstream>
+#include <valarray>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -11,7 +14,10 @@
 #include <isce3/core/LUT2d.h>
 #include <isce3/core/Metadata.h>
 #include <isce3/core/Orbit.h>
+#include <isce3/except/Error.h>
+#include <isce3/geocode/baseband.h>
 #include <isce3/geocode/geocodeSlc.h>
+#include <isce3/geocode/interpolate.h>
 #include <isce3/geometry/Serialization.h>
 #include <isce3/geometry/Topo.h>
 #include <isce3/io/IH5.h>
@@ -191,6 +197,265 @@ TEST(GeocodeTest, CheckGeocode)
     ASSERT_LT(maxErrY, 1.0e-5);
 }
 
+TEST(geocodeTest, TestGeocodeSlcMultiRaster)
+{
+    // Geocoding both rasters in a single pass must give the same result as
+    // geocoding them one at a time
+    isce3::io::IH5File file(TESTDATA_DIR "envisat.h5");
+    isce3::product::Product product(file);
+    isce3::core::Orbit orbit = product.metadata().orbit();
+    isce3::core::Ellipsoid ellipsoid;
+
+    isce3::core::LUT2d<double> imageGridDoppler =
+            product.metadata().procInfo().dopplerCentroid('A');
+    isce3::core::Matrix<double> M(imageGridDoppler.length(),
+                                  imageGridDoppler.width());
+    M.zeros();
+    isce3::core::LUT2d<double> nativeDoppler(
+            imageGridDoppler.xStart(), imageGridDoppler.yStart(),
+            imageGridDoppler.xSpacing(), imageGridDoppler.ySpacing(), M);
+
+    isce3::product::RadarGridParameters radarGrid(product, 'A');
+    const int geoGridLength = 500;
+    const int geoGridWidth = 500;
+    isce3::product::GeoGridParameters geoGrid(-115.65, 34.84, 0.0002, -8.0e-5,
+                                              geoGridWidth, geoGridLength,
+                                              4326);
+
+    isce3::io::Raster demRaster("zeroHeightDEM.geo");
+    isce3::io::Raster inputSlcX("x.slc", GA_ReadOnly);
+    isce3::io::Raster inputSlcY("y.slc", GA_ReadOnly);
+    // the output rasters are closed, and flushed, at the end of the scope
+    {
+        isce3::io::Raster geocodedSlcX("xslc_multi.geo", geoGridWidth,
+                                       geoGridLength, 1, GDT_CFloat32, "ENVI");
+        isce3::io::Raster geocodedSlcY("yslc_multi.geo", geoGridWidth,
+                                       geoGridLength, 1, GDT_CFloat32, "ENVI");
+
+        isce3::geocode::geocodeSlc({&geocodedSlcX, &geocodedSlcY},
+                                   {&inputSlcX, &inputSlcY}, demRaster,
+                                   radarGrid, geoGrid, orbit, nativeDoppler,
+                                   imageGridDoppler, ellipsoid, 1.0e-9, 25,
+                                   1000, 0.1, false);
+
+        ASSERT_THROW(isce3::geocode::geocodeSlc(
+                             {&geocodedSlcX}, {&inputSlcX, &inputSlcY},
+                             demRaster, radarGrid, geoGrid, orbit,
+                             nativeDoppler, imageGridDoppler, ellipsoid,
+                             1.0e-9, 25, 1000, 0.1, false),
+                     isce3::except::LengthError);
+    }
+
+    for (auto name : {"xslc", "yslc"}) {
+        isce3::io::Raster single(std::string(name) + ".geo");
+        isce3::io::Raster multi(std::string(name) + "_multi.geo");
+        std::valarray<std::complex<float>> singleData(geoGridLength *
+                                                      geoGridWidth),
+                multiData(geoGridLength * geoGridWidth);
+        single.getBlock(singleData, 0, 0, geoGridWidth, geoGridLength);
+        multi.getBlock(multiData, 0, 0, geoGridWidth, geoGridLength);
+        for (size_t i = 0; i < singleData.size(); ++i)
+            ASSERT_EQ(singleData[i], multiData[i]);
+    }
+}
+
+TEST(geocodeTest, TestGeocodeSlcMemoryBudget)
+{
+    // Blocks sized from a memory budget must give the same result as the
+    // single block of TestGeocodeSlc
+    isce3::io::IH5File file(TESTDATA_DIR "envisat.h5");
+    isce3::product::Product product(file);
+    isce3::core::Orbit orbit = product.metadata().orbit();
+    isce3::core::Ellipsoid ellipsoid;
+
+    isce3::core::LUT2d<double> imageGridDoppler =
+            product.metadata().procInfo().dopplerCentroid('A');
+    isce3::core::Matrix<double> M(imageGridDoppler.length(),
+                                  imageGridDoppler.width());
+    M.zeros();
+    isce3::core::LUT2d<double> nativeDoppler(
+            imageGridDoppler.xStart(), imageGridDoppler.yStart(),
+            imageGridDoppler.xSpacing(), imageGridDoppler.ySpacing(), M);
+
+    isce3::product::RadarGridParameters radarGrid(product, 'A');
+    const int geoGridLength = 500;
+    const int geoGridWidth = 500;
+    isce3::product::GeoGridParameters geoGrid(-115.65, 34.84, 0.0002, -8.0e-5,
+                                              geoGridWidth, geoGridLength,
+                                              4326);
+
+    isce3::io::Raster demRaster("zeroHeightDEM.geo");
+    const double demBlockMargin = 0.1;
+
+    // budget of blocks of 120 lines
+    const auto memory = isce3::geocode::geocodeSlcBlockMemory(
+            demRaster, radarGrid, geoGrid, demBlockMargin);
+    ASSERT_GT(memory.bytesPerLine(), 0);
+    const size_t linesPerBlock = isce3::geocode::geocodeSlcLinesPerBlock(
+            demRaster, radarGrid, geoGrid, demBlockMargin, memory.peak(120));
+    ASSERT_EQ(linesPerBlock, 120);
+    ASSERT_EQ(isce3::geocode::geocodeSlcLinesPerBlock(
+                      demRaster, radarGrid, geoGrid, demBlockMargin, 0),
+              1);
+
+    isce3::io::Raster inputSlc("x.slc", GA_ReadOnly);
+    {
+        isce3::io::Raster geocodedSlc("xslc_budget.geo", geoGridWidth,
+                                      geoGridLength, 1, GDT_CFloat32, "ENVI");
+        isce3::geocode::geocodeSlc(geocodedSlc, inputSlc, demRaster,
+                                   radarGrid, geoGrid, orbit, nativeDoppler,
+                                   imageGridDoppler, ellipsoid, 1.0e-9, 25,
+                                   linesPerBlock, demBlockMargin, false);
+    }
+
+    isce3::io::Raster single("xslc.geo");
+    isce3::io::Raster budget("xslc_budget.geo");
+    std::valarray<std::complex<float>> singleData(geoGridLength *
+                                                  geoGridWidth),
+            budgetData(geoGridLength * geoGridWidth);
+    single.getBlock(singleData, 0, 0, geoGridWidth, geoGridLength);
+    budget.getBlock(budgetData, 0, 0, geoGridWidth, geoGridLength);
+    for (size_t i = 0; i < singleData.size(); ++i)
+        ASSERT_NEAR(std::abs(budgetData[i] - singleData[i]), 0.0,
+                    1.0e-5 * std::max(1.0f, std::abs(singleData[i])));
+}
+
+TEST(geocodeTest, TestGeocodeSlcHilbertTiles)
+{
+    // Geocoding in Hilbert-ordered tiles must give the same result as the
+    // single block of lines of TestGeocodeSlc
+    isce3::io::IH5File file(TESTDATA_DIR "envisat.h5");
+    isce3::product::Product product(file);
+    isce3::core::Orbit orbit = product.metadata().orbit();
+    isce3::core::Ellipsoid ellipsoid;
+
+    isce3::core::LUT2d<double> imageGridDoppler =
+            product.metadata().procInfo().dopplerCentroid('A');
+    isce3::core::Matrix<double> M(imageGridDoppler.length(),
+                                  imageGridDoppler.width());
+    M.zeros();
+    isce3::core::LUT2d<double> nativeDoppler(
+            imageGridDoppler.xStart(), imageGridDoppler.yStart(),
+            imageGridDoppler.xSpacing(), imageGridDoppler.ySpacing(), M);
+
+    isce3::product::RadarGridParameters radarGrid(product, 'A');
+    const int geoGridLength = 500;
+    const int geoGridWidth = 500;
+    isce3::product::GeoGridParameters geoGrid(-115.65, 34.84, 0.0002, -8.0e-5,
+                                              geoGridWidth, geoGridLength,
+                                              4326);
+
+    // tiles of the pixels of 50 lines, i.e. 158 x 158 pixels
+    const size_t linesPerBlock = 50;
+    const auto blocks = isce3::geometry::geoGridBlocks(
+            geoGridLength, geoGridWidth, linesPerBlock,
+            isce3::geometry::HILBERT_TILES);
+    ASSERT_GT(blocks.size(), 1);
+    ASSERT_LT(blocks[0].width, geoGridWidth);
+
+    isce3::io::Raster demRaster("zeroHeightDEM.geo");
+    isce3::io::Raster inputSlc("x.slc", GA_ReadOnly);
+    {
+        isce3::io::Raster geocodedSlc("xslc_tiles.geo", geoGridWidth,
+                                      geoGridLength, 1, GDT_CFloat32, "ENVI");
+        isce3::geocode::geocodeSlc(geocodedSlc, inputSlc, demRaster,
+                                   radarGrid, geoGrid, orbit, nativeDoppler,
+                                   imageGridDoppler, ellipsoid, 1.0e-9, 25,
+                                   linesPerBlock, 0.1, false, {}, "NEAREST",
+                                   isce3::geometry::HILBERT_TILES);
+    }
+
+    isce3::io::Raster single("xslc.geo");
+    isce3::io::Raster tiles("xslc_tiles.geo");
+    std::valarray<std::complex<float>> singleData(geoGridLength *
+                                                  geoGridWidth),
+            tilesData(geoGridLength * geoGridWidth);
+    single.getBlock(singleData, 0, 0, geoGridWidth, geoGridLength);
+    tiles.getBlock(tilesData, 0, 0, geoGridWidth, geoGridLength);
+    for (size_t i = 0; i < singleData.size(); ++i)
+        ASSERT_NEAR(std::abs(tilesData[i] - singleData[i]), 0.0,
+                    1.0e-5 * std::max(1.0f, std::abs(singleData[i])));
+}
+
+TEST(geocodeTest, FootprintBaseband)
+{
+    // radar block with a range and azimuth varying Doppler
+    const int length = 120, width = 90;
+    isce3::core::Matrix<std::complex<float>> data(length, width);
+    for (int i = 0; i < length; ++i)
+        for (int j = 0; j < width; ++j)
+            data(i, j) = std::complex<float>(std::cos(0.1 * i * j),
+                                             std::sin(0.3 * i - 0.2 * j));
+
+    isce3::core::Matrix<double> dop(3, 3);
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            dop(i, j) = 100.0 + 20.0 * i - 15.0 * j;
+    const double startingRange = 800000.0, rangeSpacing = 10.0;
+    const double sensingStart = 10.0, prf = 1000.0;
+    isce3::core::LUT2d<double> doppler(startingRange, sensingStart, 500.0,
+                                       0.1, dop);
+
+    // geocoded pixels in a rotated strip of the block, some outside it
+    const int geoLength = 40, geoWidth = 30;
+    std::valarray<double> radarX(geoLength * geoWidth),
+            radarY(geoLength * geoWidth);
+    std::valarray<std::complex<double>> phase(geoLength * geoWidth);
+    for (int i = 0; i < geoLength; ++i) {
+        for (int j = 0; j < geoWidth; ++j) {
+            radarX[i * geoWidth + j] = 100.3 + 0.9 * j - 0.4 * i;
+            radarY[i * geoWidth + j] = 200.7 + 0.35 * j + 1.1 * i;
+            phase[i * geoWidth + j] = std::polar(1.0, 0.01 * (i + j));
+        }
+    }
+    const int azimuthFirstLine = 195, rangeFirstPixel = 80;
+
+    auto interp = std::make_unique<
+            isce3::core::Sinc2dInterpolator<std::complex<float>>>(
+            isce3::core::SINC_LEN, isce3::core::SINC_SUB);
+
+    // reference: baseband the whole block
+    // (copies through a const reference own their data)
+    const auto& constData = data;
+    isce3::core::Matrix<std::complex<float>> full(constData);
+    isce3::geocode::baseband(full, startingRange, sensingStart, rangeSpacing,
+                             prf, doppler);
+    isce3::core::Matrix<std::complex<float>> geoFull(geoLength, geoWidth);
+    isce3::geocode::interpolate(full, geoFull, radarX, radarY, phase, width,
+                                length, azimuthFirstLine, rangeFirstPixel,
+                                interp.get());
+
+    // baseband only the footprint of the sinc chips
+    std::vector<int> firstCol, lastCol;
+    isce3::geocode::chipFootprint(radarX, radarY, width, length,
+                                  azimuthFirstLine, rangeFirstPixel, firstCol,
+                                  lastCol);
+    size_t footprint = 0;
+    for (int i = 0; i < length; ++i)
+        footprint += std::max(0, lastCol[i] - firstCol[i] + 1);
+    ASSERT_GT(footprint, 0);
+    ASSERT_LT(footprint, size_t(length * width / 2));
+
+    isce3::core::Matrix<std::complex<float>> phasor(length, width);
+    isce3::geocode::basebandPhasor(phasor, firstCol, lastCol, startingRange,
+                                   sensingStart, rangeSpacing, prf, doppler);
+    isce3::core::Matrix<std::complex<float>> partial(constData);
+    isce3::geocode::baseband(partial, phasor, firstCol, lastCol);
+    isce3::core::Matrix<std::complex<float>> geoPartial(geoLength, geoWidth);
+    isce3::geocode::interpolate(partial, geoPartial, radarX, radarY, phase,
+                                width, length, azimuthFirstLine,
+                                rangeFirstPixel, interp.get());
+
+    size_t nonzero = 0;
+    for (int i = 0; i < geoLength; ++i) {
+        for (int j = 0; j < geoWidth; ++j) {
+            ASSERT_EQ(geoPartial(i, j), geoFull(i, j));
+            nonzero += std::abs(geoFull(i, j)) > 0;
+        }
+    }
+    ASSERT_GT(nonzero, 0);
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
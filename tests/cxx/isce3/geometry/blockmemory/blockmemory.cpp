@@ -0,0 +1,68 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <isce3/geometry/BlockMemory.h>
+#include <isce3/io/Raster.h>
+#include <isce3/product/GeoGridParameters.h>
+
+using isce3::geometry::BlockMemory;
+
+TEST(BlockMemoryTest, LinesPerBlock) {
+    BlockMemory memory(100, 1000);
+    ASSERT_EQ(memory.peak(40), 5000);
+
+    // Lines fitting in the budget, within the grid
+    ASSERT_EQ(memory.linesPerBlock(5000, 100), 40);
+    ASSERT_EQ(memory.linesPerBlock(5099, 100), 40);
+    ASSERT_EQ(memory.linesPerBlock(5000, 30), 30);
+
+    // At least one line, even over budget
+    ASSERT_EQ(memory.linesPerBlock(500, 100), 1);
+
+    // Footprints add up
+    memory += BlockMemory(50, 500);
+    ASSERT_EQ(memory.bytesPerLine(), 150);
+    ASSERT_EQ(memory.fixedBytes(), 1500);
+    ASSERT_EQ(memory.linesPerBlock(3000, 100), 10);
+
+    // Whole grid in one block when nothing depends on the block length
+    ASSERT_EQ(BlockMemory(0, 1000).linesPerBlock(10, 100), 100);
+}
+
+TEST(BlockMemoryTest, DEM) {
+    // LonLat DEM of 100 x 80 pixels of 0.5 degrees
+    const std::string filename = "blockmemory_dem.tif";
+    std::remove(filename.c_str());
+    {
+        isce3::io::Raster raster(filename, 100, 80, 1, GDT_Float32, "GTiff");
+        std::vector<double> transform {-120.0, 0.5, 0.0, 40.0, 0.0, -0.5};
+        raster.setGeoTransform(transform);
+        raster.setEPSG(4326);
+    }
+    isce3::io::Raster dem(filename);
+
+    // 20 x 20 DEM pixels over the grid, 2 pixels of margin on each side
+    // across, 4 pixels along the edges of each block
+    BlockMemory memory = isce3::geometry::demBlockMemory(dem, -110, -100, 10,
+                                                         20, 1.0, 10);
+    ASSERT_EQ(memory.bytesPerLine(), 25 * 20 / 10 * sizeof(float));
+    ASSERT_EQ(memory.fixedBytes(), 25 * 5 * sizeof(float));
+
+    // Same bounds from a geocoded grid of 100 lines
+    isce3::product::GeoGridParameters geoGrid(-110, 20, 0.1, -0.1, 100, 100,
+                                              4326);
+    memory = isce3::geometry::demBlockMemory(dem, geoGrid, 1.0);
+    ASSERT_EQ(memory.bytesPerLine(), 25 * 20 / 100 * sizeof(float));
+    ASSERT_EQ(memory.fixedBytes(), 25 * 5 * sizeof(float));
+
+    // Clipped to the DEM
+    memory = isce3::geometry::demBlockMemory(dem, -130, 0, -50, 50, 1.0, 80);
+    ASSERT_EQ(memory.bytesPerLine(), 100 * sizeof(float));
+}
+
+int main(int argc, char * argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
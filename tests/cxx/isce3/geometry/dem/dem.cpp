@@ -7,6 +7,7 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 #include <gtest/gtest.h>
 
 // isce3::core
@@ -49,6 +50,44 @@ TEST(DEMTest, MethodConstruct) {
     }
 }
 
+TEST(DEMTest, BatchInterpolation) {
+
+    isce3::io::Raster demRaster(TESTDATA_DIR "srtm_cropped.tif");
+
+    std::vector<isce3::core::dataInterpMethod> methods = { isce3::core::BILINEAR_METHOD,
+                                                          isce3::core::BICUBIC_METHOD,
+                                                          isce3::core::BIQUINTIC_METHOD };
+
+    for (auto &method: methods)
+    {
+        isce3::geometry::DEMInterpolator dem(0.0, method);
+        dem.loadDEM(demRaster);
+
+        // Points inside the DEM, on its nodes and outside it
+        const size_t n = 500;
+        std::vector<double> x(n), y(n), z(n);
+        for (size_t i = 0; i < n; ++i) {
+            x[i] = dem.xStart() + dem.deltaX() * (i % 7 == 0 ? i / 7.0 : 1.37 * i - 30);
+            y[i] = dem.yStart() + dem.deltaY() * (i % 5 == 0 ? i / 5.0 : 0.71 * i + 1.5);
+        }
+        dem.interpolateXY(x.data(), y.data(), z.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(z[i], dem.interpolateXY(x[i], y[i]));
+        }
+
+        std::vector<double> lon(n), lat(n);
+        for (size_t i = 0; i < n; ++i) {
+            const isce3::core::Vec3 llh = dem.midLonLat();
+            lon[i] = llh[0] + 1.0e-4 * (i % 23) - 1.0e-3;
+            lat[i] = llh[1] + 1.0e-4 * (i % 19) - 1.0e-3;
+        }
+        dem.interpolateLonLat(lon.data(), lat.data(), z.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(z[i], dem.interpolateLonLat(lon[i], lat[i]));
+        }
+    }
+}
+
 int main(int argc, char * argv[]) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
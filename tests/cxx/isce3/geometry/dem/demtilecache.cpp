@@ -0,0 +1,149 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <isce3/except/Error.h>
+#include <isce3/io/ConcurrentRasterReader.h>
+#include <isce3/io/Raster.h>
+#include <isce3/geometry/DEMTileCache.h>
+
+struct DEMTileCacheTest : public ::testing::Test {
+    const int width = 300;
+    const int length = 200;
+    const std::string filename = "demtilecache.tif";
+
+    std::vector<float> data;
+
+    void SetUp() override {
+        data.resize(width * length);
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = (i * 13) % 1009;
+        }
+        std::remove(filename.c_str());
+        isce3::io::Raster raster(filename, width, length, 1, GDT_Float32, "GTiff");
+        raster.setBlock(data, 0, 0, width, length);
+    }
+
+    // Check a block read through the cache against the data
+    void checkBlock(const std::vector<float> & block, int xstart, int ystart,
+                    int blockWidth, int blockLength) {
+        for (int i = 0; i < blockLength; ++i) {
+            for (int j = 0; j < blockWidth; ++j) {
+                ASSERT_EQ(block[i * blockWidth + j],
+                          data[(ystart + i) * width + xstart + j]);
+            }
+        }
+    }
+};
+
+TEST_F(DEMTileCacheTest, SharedTiles) {
+    isce3::geometry::DEMTileCache cache(1 << 20, 64);
+    isce3::io::Raster raster(filename);
+
+    // 5 x 4 tiles, the last ones partial
+    std::vector<float> block(100 * 90);
+    cache.getBlock(raster, block.data(), 50, 30, 100, 90);
+    checkBlock(block, 50, 30, 100, 90);
+    ASSERT_EQ(cache.misses(), 6);
+    ASSERT_EQ(cache.hits(), 0);
+    ASSERT_EQ(cache.memoryUsage(), 6 * 64 * 64 * sizeof(float));
+
+    // Overlapping blocks read from multiple threads through a reader of the
+    // same file share the tiles
+    isce3::io::ConcurrentRasterReader reader(raster);
+    #pragma omp parallel for
+    for (int ystart = 0; ystart <= length - 40; ystart += 20) {
+        std::vector<float> threadBlock(width * 40);
+        cache.getBlock(reader, threadBlock.data(), 0, ystart, width, 40);
+        checkBlock(threadBlock, 0, ystart, width, 40);
+    }
+    ASSERT_EQ(cache.misses(), 20);
+
+    // Partial tiles at the edges hold only the pixels of the raster
+    ASSERT_EQ(cache.memoryUsage(), size_t(width) * length * sizeof(float));
+}
+
+TEST_F(DEMTileCacheTest, Eviction) {
+    const size_t tileBytes = 64 * 64 * sizeof(float);
+    isce3::geometry::DEMTileCache cache(2 * tileBytes, 64);
+    isce3::io::Raster raster(filename);
+
+    std::vector<float> block(64 * 64);
+    cache.getBlock(raster, block.data(), 0, 0, 64, 64);
+    cache.getBlock(raster, block.data(), 64, 0, 64, 64);
+    cache.getBlock(raster, block.data(), 0, 0, 64, 64);
+    ASSERT_EQ(cache.hits(), 1);
+
+    // The least recently used tile is evicted
+    cache.getBlock(raster, block.data(), 128, 0, 64, 64);
+    checkBlock(block, 128, 0, 64, 64);
+    ASSERT_EQ(cache.memoryUsage(), 2 * tileBytes);
+    cache.getBlock(raster, block.data(), 0, 0, 64, 64);
+    ASSERT_EQ(cache.hits(), 2);
+    cache.getBlock(raster, block.data(), 64, 0, 64, 64);
+    ASSERT_EQ(cache.misses(), 4);
+
+    // No caching with a budget of 0
+    cache.memoryBudget(0);
+    ASSERT_EQ(cache.memoryUsage(), 0);
+    cache.getBlock(raster, block.data(), 64, 0, 64, 64);
+    checkBlock(block, 64, 0, 64, 64);
+    ASSERT_EQ(cache.misses(), 4);
+
+    ASSERT_THROW(isce3::geometry::DEMTileCache(1, 0),
+                 isce3::except::InvalidArgument);
+}
+
+TEST_F(DEMTileCacheTest, Bypass) {
+    isce3::geometry::DEMTileCache cache(1 << 20, 64);
+
+    // Rasters opened for update are read directly
+    isce3::io::Raster raster(filename, GA_Update);
+    std::vector<float> block(32 * 32);
+    cache.getBlock(raster, block.data(), 10, 10, 32, 32);
+    checkBlock(block, 10, 10, 32, 32);
+    ASSERT_EQ(cache.misses(), 0);
+    ASSERT_EQ(cache.memoryUsage(), 0);
+
+    ASSERT_THROW(cache.getBlock(raster, block.data(), width - 10, 0, 32, 32),
+                 isce3::except::OutOfRange);
+}
+
+TEST_F(DEMTileCacheTest, Rewrite) {
+    isce3::geometry::DEMTileCache cache(1 << 20, 64);
+
+    std::vector<float> block(32 * 32);
+    {
+        isce3::io::Raster raster(filename);
+        cache.getBlock(raster, block.data(), 0, 0, 32, 32);
+        checkBlock(block, 0, 0, 32, 32);
+    }
+    ASSERT_EQ(cache.misses(), 1);
+
+    // A DEM of the same size rewritten right away is read again
+    for (auto & value : data) {
+        value += 1.0f;
+    }
+    {
+        isce3::io::Raster raster(filename, GA_Update);
+        raster.setBlock(data, 0, 0, width, length);
+    }
+    {
+        isce3::io::Raster raster(filename);
+        cache.getBlock(raster, block.data(), 0, 0, 32, 32);
+        checkBlock(block, 0, 0, 32, 32);
+    }
+    ASSERT_EQ(cache.misses(), 2);
+
+    // Clearing releases the tiles
+    cache.clear();
+    ASSERT_EQ(cache.memoryUsage(), 0);
+    ASSERT_EQ(cache.misses(), 0);
+    ASSERT_EQ(cache.hits(), 0);
+}
+
+int main(int argc, char * argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -240,6 +240,194 @@ TEST(GeocodeTest, CheckGeocode) {
     }
 }
 
+TEST(GeocodeTest, HilbertTiles) {
+    // Geocoding tiles traversed along a Hilbert curve gives the same output
+    // as geocoding blocks of lines. The padded radar blocks of the tiles may
+    // also keep pixels at the edges of the swath.
+
+    std::string h5file(TESTDATA_DIR "envisat.h5");
+    isce3::io::IH5File file(h5file);
+    isce3::product::Product product(file);
+    const isce3::product::Swath & swath = product.swath('A');
+
+    isce3::geometry::Geocode<double> geoObj;
+    geoObj.orbit(product.metadata().orbit());
+    geoObj.doppler(product.metadata().procInfo().dopplerCentroid('A'));
+    isce3::core::Ellipsoid ellipsoid;
+    geoObj.ellipsoid(ellipsoid);
+    geoObj.thresholdGeo2rdr(1.0e-9);
+    geoObj.numiterGeo2rdr(25);
+    geoObj.demBlockMargin(0.1);
+    geoObj.radarBlockMargin(10);
+    geoObj.interpolator(isce3::core::BIQUINTIC_METHOD);
+
+    // tiles of about 9 x 9 pixels
+    geoObj.linesPerBlock(2);
+    geoObj.blockTraversal(isce3::geometry::HILBERT_TILES);
+
+    isce3::io::Raster referenceRaster("x.interp.geo");
+    const size_t width = referenceRaster.width();
+    const size_t length = referenceRaster.length();
+    geoObj.geoGrid(-115.6, 34.832, 0.002, -8.0e-4, width, length, 4326);
+
+    isce3::product::RadarGridParameters radar_grid(swath, product.lookSide());
+    isce3::io::Raster demRaster("zeroHeightDEM.geo");
+    isce3::io::Raster radarRasterX("x.rdr");
+    {
+        isce3::io::Raster geocodedRaster("x.tiles.geo", width, length, 1,
+                                         GDT_Float64, "ENVI");
+        geoObj.geocode(radar_grid, radarRasterX, geocodedRaster, demRaster,
+                       isce3::geometry::geocodeOutputMode::INTERP);
+    }
+
+    std::valarray<double> reference(length * width), tiles(length * width);
+    referenceRaster.getBlock(reference, 0, 0, width, length);
+    isce3::io::Raster tilesRaster("x.tiles.geo");
+    tilesRaster.getBlock(tiles, 0, 0, width, length);
+
+    int nvalid = 0;
+    for (size_t i = 0; i < length * width; ++i) {
+        if (!std::isnan(reference[i])) {
+            ASSERT_FALSE(std::isnan(tiles[i]));
+            ASSERT_NEAR(tiles[i], reference[i], 1.0e-10);
+            nvalid++;
+        }
+    }
+    ASSERT_GT(nvalid, 0);
+}
+
+TEST(GeocodeTest, DemInOtherProjection) {
+    // The DEM of each block of lines of a UTM grid is loaded from the
+    // longitude/latitude DEM around that block: geocoding in several blocks
+    // gives the same output as geocoding in a single one
+
+    std::string h5file(TESTDATA_DIR "envisat.h5");
+    isce3::io::IH5File file(h5file);
+    isce3::product::Product product(file);
+    const isce3::product::Swath & swath = product.swath('A');
+
+    isce3::geometry::Geocode<double> geoObj;
+    geoObj.orbit(product.metadata().orbit());
+    geoObj.doppler(product.metadata().procInfo().dopplerCentroid('A'));
+    isce3::core::Ellipsoid ellipsoid;
+    geoObj.ellipsoid(ellipsoid);
+    geoObj.thresholdGeo2rdr(1.0e-9);
+    geoObj.numiterGeo2rdr(25);
+    geoObj.demBlockMargin(0.01);
+    geoObj.radarBlockMargin(10);
+    geoObj.interpolator(isce3::core::BIQUINTIC_METHOD);
+
+    // UTM zone 11N grid over the swath
+    const size_t width = 40, length = 20;
+    geoObj.geoGrid(628500.0, 3855000.0, 150.0, -150.0, width, length, 32611);
+
+    isce3::product::RadarGridParameters radar_grid(swath, product.lookSide());
+    isce3::io::Raster demRaster(TESTDATA_DIR "srtm_cropped.tif");
+    isce3::io::Raster radarRasterX("x.rdr");
+    for (size_t linesPerBlock : {length, size_t(4)}) {
+        isce3::io::Raster geocodedRaster(
+                "x.utm" + std::to_string(linesPerBlock) + ".geo", width,
+                length, 1, GDT_Float64, "ENVI");
+        geoObj.linesPerBlock(linesPerBlock);
+        geoObj.geocode(radar_grid, radarRasterX, geocodedRaster, demRaster,
+                       isce3::geometry::geocodeOutputMode::INTERP);
+    }
+
+    std::valarray<double> reference(length * width), blocks(length * width);
+    isce3::io::Raster referenceRaster("x.utm" + std::to_string(length) +
+                                      ".geo");
+    referenceRaster.getBlock(reference, 0, 0, width, length);
+    isce3::io::Raster blocksRaster("x.utm4.geo");
+    blocksRaster.getBlock(blocks, 0, 0, width, length);
+
+    int nvalid = 0;
+    for (size_t i = 0; i < length * width; ++i) {
+        ASSERT_EQ(std::isnan(blocks[i]), std::isnan(reference[i]));
+        if (!std::isnan(reference[i])) {
+            ASSERT_NEAR(blocks[i], reference[i], 1.0e-8);
+            nvalid++;
+        }
+    }
+    ASSERT_GT(nvalid, 0);
+}
+
+TEST(GeocodeTest, MemoryBudget) {
+    // Blocks sized from a memory budget have the predicted number of lines
+    // and give the same output as blocks of that fixed number of lines
+
+    std::string h5file(TESTDATA_DIR "envisat.h5");
+    isce3::io::IH5File file(h5file);
+    isce3::product::Product product(file);
+    const isce3::product::Swath & swath = product.swath('A');
+
+    isce3::geometry::Geocode<double> geoObj;
+    geoObj.orbit(product.metadata().orbit());
+    geoObj.doppler(product.metadata().procInfo().dopplerCentroid('A'));
+    isce3::core::Ellipsoid ellipsoid;
+    geoObj.ellipsoid(ellipsoid);
+    geoObj.thresholdGeo2rdr(1.0e-9);
+    geoObj.numiterGeo2rdr(25);
+    geoObj.demBlockMargin(0.01);
+    geoObj.radarBlockMargin(10);
+    geoObj.interpolator(isce3::core::BIQUINTIC_METHOD);
+
+    const size_t width = 40, length = 20;
+    geoObj.geoGrid(628500.0, 3855000.0, 150.0, -150.0, width, length, 32611);
+
+    isce3::product::RadarGridParameters radar_grid(swath, product.lookSide());
+    isce3::io::Raster demRaster(TESTDATA_DIR "srtm_cropped.tif");
+    isce3::io::Raster radarRasterX("x.rdr");
+
+    // fixed number of lines
+    {
+        isce3::io::Raster geocodedRaster("x.lines.geo", width, length, 1,
+                                         GDT_Float64, "ENVI");
+        geoObj.linesPerBlock(6);
+        geoObj.geocode(radar_grid, radarRasterX, geocodedRaster, demRaster,
+                       isce3::geometry::geocodeOutputMode::INTERP);
+    }
+
+    // budget of blocks of 6 lines
+    {
+        isce3::io::Raster geocodedRaster("x.budget.geo", width, length, 1,
+                                         GDT_Float64, "ENVI");
+        const isce3::geometry::BlockMemory memory = geoObj.blockMemory(
+                radar_grid, radarRasterX, geocodedRaster, demRaster);
+        ASSERT_GT(memory.bytesPerLine(), 0);
+
+        geoObj.linesPerBlock(1000);
+        geoObj.memoryBudget(memory.peak(6));
+        ASSERT_EQ(geoObj.linesPerBlock(radar_grid, radarRasterX,
+                                       geocodedRaster, demRaster), 6);
+        ASSERT_LE(geoObj.peakMemory(radar_grid, radarRasterX, geocodedRaster,
+                                    demRaster), memory.peak(6));
+        geoObj.geocode(radar_grid, radarRasterX, geocodedRaster, demRaster,
+                       isce3::geometry::geocodeOutputMode::INTERP);
+    }
+
+    std::valarray<double> lines(length * width), budget(length * width);
+    isce3::io::Raster linesRaster("x.lines.geo");
+    linesRaster.getBlock(lines, 0, 0, width, length);
+    isce3::io::Raster budgetRaster("x.budget.geo");
+    budgetRaster.getBlock(budget, 0, 0, width, length);
+    for (size_t i = 0; i < length * width; ++i) {
+        ASSERT_EQ(std::isnan(budget[i]), std::isnan(lines[i]));
+        if (!std::isnan(lines[i])) {
+            ASSERT_NEAR(budget[i], lines[i], 1.0e-8);
+        }
+    }
+
+    // an empty geo grid is processed in blocks of one line
+    geoObj.geoGrid(628500.0, 3855000.0, 150.0, -150.0, width, 0, 32611);
+    isce3::io::Raster emptyRaster("x.empty.geo", width, 1, 1, GDT_Float64,
+                                  "ENVI");
+    ASSERT_EQ(geoObj.linesPerBlock(radar_grid, radarRasterX, emptyRaster,
+                                   demRaster), 1);
+    geoObj.memoryBudget(0);
+    ASSERT_EQ(geoObj.linesPerBlock(radar_grid, radarRasterX, emptyRaster,
+                                   demRaster), 1);
+}
+
 int main(int argc, char * argv[]) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,70 @@
+#include <cstdlib>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <isce3/except/Error.h>
+#include <isce3/geometry/GeoGridBlocks.h>
+
+using isce3::geometry::GeoGridBlock;
+
+// Check that the blocks cover each pixel of the grid once
+void checkCover(const std::vector<GeoGridBlock> & blocks, int length,
+                int width) {
+    std::vector<int> count(length * width, 0);
+    for (const auto & block : blocks) {
+        ASSERT_GT(block.length, 0);
+        ASSERT_GT(block.width, 0);
+        ASSERT_LE(block.lineStart + block.length, length);
+        ASSERT_LE(block.pixelStart + block.width, width);
+        for (int i = 0; i < block.length; ++i)
+            for (int j = 0; j < block.width; ++j)
+                count[(block.lineStart + i) * width + block.pixelStart + j]++;
+    }
+    for (int c : count)
+        ASSERT_EQ(c, 1);
+}
+
+TEST(GeoGridBlocksTest, BlocksOfLines) {
+    auto blocks = isce3::geometry::geoGridBlocks(25, 40, 10);
+    ASSERT_EQ(blocks.size(), 3);
+    ASSERT_EQ(blocks[2].lineStart, 20);
+    ASSERT_EQ(blocks[2].length, 5);
+    ASSERT_EQ(blocks[2].width, 40);
+    checkCover(blocks, 25, 40);
+
+    ASSERT_THROW(isce3::geometry::geoGridBlocks(25, 40, 0),
+                 isce3::except::InvalidArgument);
+}
+
+TEST(GeoGridBlocksTest, HilbertTiles) {
+    // 100 x 100 pixel tiles, 4 x 4 of them
+    const int length = 400, width = 400;
+    auto blocks = isce3::geometry::geoGridBlocks(length, width, 25,
+            isce3::geometry::HILBERT_TILES);
+    ASSERT_EQ(blocks.size(), 16);
+    checkCover(blocks, length, width);
+
+    // Consecutive tiles are neighbors
+    for (size_t i = 1; i < blocks.size(); ++i) {
+        const int dy = std::abs(blocks[i].lineStart - blocks[i - 1].lineStart);
+        const int dx = std::abs(blocks[i].pixelStart - blocks[i - 1].pixelStart);
+        ASSERT_EQ(dx + dy, 100);
+    }
+
+    // Partial tiles at the edges of a non-square grid
+    blocks = isce3::geometry::geoGridBlocks(250, 370, 20,
+            isce3::geometry::HILBERT_TILES);
+    checkCover(blocks, 250, 370);
+
+    // Tiles as wide as narrow grids
+    blocks = isce3::geometry::geoGridBlocks(1000, 10, 100,
+            isce3::geometry::HILBERT_TILES);
+    ASSERT_EQ(blocks.size(), 10);
+    ASSERT_EQ(blocks[0].width, 10);
+    checkCover(blocks, 1000, 10);
+}
+
+int main(int argc, char * argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1168,6 +1168,70 @@ TEST_F(IH5Test, createFloat16Dataset) {
 }
 
 
+TEST_F(IH5Test, chunkAlignedBlocksAndCache) {
+
+    isce3::io::IH5File fic;
+    EXPECT_NO_THROW(fic = isce3::io::IH5File(wFileName,'w'));
+
+    // Chunked (128x128) and compressed 1000x300 dataset
+    std::vector<float> v1(1000*300);
+    std::iota(v1.begin(), v1.end(), 0.0f);
+    isce3::io::IGroup grp = fic.openGroup("/groupVector");
+    std::array<int, 2> dims = {1000, 300};
+    isce3::io::IDataSet dset = grp.createDataSet<float>(
+            std::string("vChunkCache"), dims, 1, 1, 4);
+    dset.write(v1);
+
+    // Chunk layout
+    ASSERT_EQ(dset.getChunkBytes(), 128 * 128 * sizeof(float));
+    ASSERT_EQ(dset.getChunkAlignedBlockLength(300), 256);
+    ASSERT_EQ(dset.getChunkAlignedBlockLength(50), 128);
+    ASSERT_THROW(dset.getChunkAlignedBlockLength(0),
+                 isce3::except::InvalidArgument);
+
+    auto blocks = dset.getChunkAlignedBlocks(300);
+    ASSERT_EQ(blocks.size(), 4);
+    ASSERT_EQ(blocks[1][0], 256);
+    ASSERT_EQ(blocks[3][0], 768);
+    ASSERT_EQ(blocks[3][1], 232);
+
+    // Cache limited by the budget, then by the chunks one block touches
+    const size_t chunkBytes = dset.getChunkBytes();
+    auto cache = dset.getChunkCacheForBudget(5 * chunkBytes + 10);
+    ASSERT_EQ(cache.nbytes, 5 * chunkBytes);
+    ASSERT_EQ(cache.nslots, 503);
+    ASSERT_EQ(cache.w0, 1.0);
+    cache = dset.getChunkCacheForBudget(100 * chunkBytes, 256);
+    ASSERT_EQ(cache.nbytes, 3 * 3 * chunkBytes);
+    ASSERT_EQ(dset.getChunkCacheForBudget(0).nbytes, chunkBytes);
+    dset.close();
+
+    // Reopen with the cache and read back in chunk-aligned blocks
+    isce3::io::IDataSet cached = grp.openDataSet("vChunkCache", cache);
+    auto opened = cached.getChunkCache();
+    ASSERT_EQ(opened.nbytes, cache.nbytes);
+    ASSERT_EQ(opened.nslots, cache.nslots);
+    ASSERT_EQ(opened.w0, cache.w0);
+
+    for (const auto& block : cached.getChunkAlignedBlocks(300)) {
+        std::vector<int> start = {block[0], 0};
+        std::vector<int> count = {block[1], 300};
+        std::vector<float> v1r;
+        cached.read(v1r, &start, &count, nullptr);
+        ASSERT_EQ(v1r.size(), block[1] * 300);
+        ASSERT_EQ(v1r.front(), v1[block[0] * 300]);
+        ASSERT_EQ(v1r.back(), v1[(block[0] + block[1]) * 300 - 1]);
+    }
+
+    // Contiguous datasets keep the defaults
+    isce3::io::IDataSet contiguous = grp.openDataSet("v1");
+    ASSERT_EQ(contiguous.getChunkBytes(), 0);
+    ASSERT_EQ(contiguous.getChunkAlignedBlockLength(37), 37);
+    ASSERT_EQ(contiguous.getChunkCacheForBudget(1 << 20).nbytes,
+              H5D_CHUNK_CACHE_NBYTES_DEFAULT);
+}
+
+
 int main( int argc, char * argv[] ) {
     testing::InitGoogleTest( &argc, argv );
     return RUN_ALL_TESTS();
@@ -0,0 +1,110 @@
+//
+
+#include <complex>
+#include <numeric>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <isce3/io/IH5.h>
+#include <isce3/io/IH5ChunkWriter.h>
+
+
+// Output HDF5 file for chunk writer tests
+std::string wFileName("dummyHdf5ChunkWriter.h5");
+
+TEST(IH5ChunkWriterTest, directCompressedWrite) {
+
+    isce3::io::IH5File fic(wFileName, 'x');
+    isce3::io::IGroup grp = fic.openGroup("/");
+
+    // 1000 x 300 dataset, 128 x 128 chunks with shuffle + deflate
+    const int length = 1000, width = 300;
+    std::vector<float> data(length * width);
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<float>((i * 7) % 1013) * 0.25f;
+
+    std::array<int, 2> dims = {length, width};
+    isce3::io::IDataSet reference = grp.createDataSet<float>(
+            std::string("reference"), dims, 1, 1, 5);
+    reference.write(data);
+
+    isce3::io::IDataSet dset = grp.createDataSet<float>(
+            std::string("direct"), dims, 1, 1, 5);
+    isce3::io::IH5ChunkWriter writer(dset, 4);
+    ASSERT_TRUE(writer.direct());
+    ASSERT_EQ(writer.chunkLength(), 128);
+    ASSERT_EQ(writer.numThreads(), 4);
+
+    // Chunk-aligned blocks, the last one ending at the last line
+    for (size_t line = 0; line < length; line += 256) {
+        const size_t lines = std::min<size_t>(256, length - line);
+        writer.writeBlock(&data[line * width], line, lines);
+    }
+
+    std::vector<float> readback;
+    dset.read(readback);
+    ASSERT_EQ(readback, data);
+
+    // Chunks are filtered exactly like the HDF5 pipeline does
+    EXPECT_EQ(dset.getStorageSize(), reference.getStorageSize());
+
+    // Out of range blocks are rejected
+    ASSERT_THROW(writer.writeBlock(data.data(), 900, 200),
+                 isce3::except::OutOfRange);
+    ASSERT_THROW(writer.writeBlock(data.data(), 0, 10, 2),
+                 isce3::except::OutOfRange);
+}
+
+TEST(IH5ChunkWriterTest, unalignedAndConvertedWrite) {
+
+    isce3::io::IH5File fic(wFileName, 'w');
+    isce3::io::IGroup grp = fic.openGroup("/");
+
+    const int length = 400, width = 200;
+    std::vector<std::complex<float>> data(length * width);
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = std::complex<float>(i % 97, -static_cast<float>(i % 13));
+
+    std::array<int, 2> dims = {length, width};
+    isce3::io::IDataSet dset = grp.createDataSet<std::complex<float>>(
+            std::string("complex"), dims, 1, 1, 3);
+    isce3::io::IH5ChunkWriter writer(dset);
+    ASSERT_TRUE(writer.direct());
+
+    // Unaligned blocks fall back to regular writes, and may update chunks
+    // written directly
+    writer.writeBlock(data.data(), 0, 100);
+    std::vector<std::complex<float>> rest(data.begin() + 128 * width,
+                                          data.end());
+    writer.writeBlock(rest, 128);
+    writer.writeBlock(&data[100 * width], 100, 28);
+
+    std::vector<std::complex<float>> readback;
+    dset.read(readback);
+    ASSERT_EQ(readback, data);
+
+    // Memory types differing from the file type are converted by HDF5
+    std::vector<double> values(length * width);
+    std::iota(values.begin(), values.end(), 0.0);
+    isce3::io::IDataSet fdset = grp.createDataSet<float>(
+            std::string("converted"), dims, 1, 0, 1);
+    isce3::io::IH5ChunkWriter fwriter(fdset);
+    fwriter.writeBlock(values, 0);
+
+    std::vector<float> freadback;
+    fdset.read(freadback);
+    ASSERT_EQ(freadback.size(), values.size());
+    ASSERT_EQ(freadback[12345], 12345.0f);
+
+    // Contiguous datasets are written through HDF5
+    isce3::io::IDataSet contiguous = grp.createDataSet<float>(
+            std::string("contiguous"), dims);
+    isce3::io::IH5ChunkWriter cwriter(contiguous);
+    ASSERT_FALSE(cwriter.direct());
+    ASSERT_EQ(cwriter.chunkLength(), 1);
+}
+
+int main(int argc, char* argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
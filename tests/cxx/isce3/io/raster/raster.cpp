@@ -166,6 +166,36 @@ TEST_F(RasterTest, setGetBlockBandTwoENVIRaster) {
 }
 
 
+// Read ENVI Raster bands through their memory maps
+TEST_F(RasterTest, memmapENVIRaster) {
+  {
+    isce3::io::Raster incUpdate = isce3::io::Raster(incFilename, GA_Update);
+    incUpdate.memmapBands();
+    ASSERT_FALSE( incUpdate.canMemmap(1) );     // only read-only rasters are mapped
+  }
+
+  isce3::io::Raster inc = isce3::io::Raster(incFilename);
+  ASSERT_FALSE( inc.canMemmap(2) );             // bands are mapped explicitly
+  inc.memmapBands();
+  ASSERT_TRUE( inc.canMemmap(2) );
+  ASSERT_EQ( inc.memmap(2).datatype(), GDT_Int16 );
+
+  auto band2 = inc.memmap<int16_t>(2);
+  ASSERT_EQ( band2.length(), nl );
+  ASSERT_EQ( band2.width(), nc );
+  for (uint l=0; l<nl; ++l)
+    for (uint c=0; c<nc; ++c)
+      ASSERT_EQ( band2(l, c), 1 );              // band 2 was filled with ones
+
+  ASSERT_THROW( inc.memmap<float>(1), isce3::except::RuntimeError );
+
+  std::valarray<int16_t> block( nbx*nby*4 ), mapped( nbx*nby*4 );
+  inc.getBlock( block, nbx, nby, 2*nbx, 2*nby, 1 );
+  inc.getBlockMapped( &mapped[0], nbx, nby, 2*nbx, 2*nby, 1 );
+  ASSERT_TRUE( (block == mapped).min() );
+}
+
+
 
 // Create VRT multiband from std::vector of Raster objects
 TEST_F(RasterTest, createMultiBandVRT) {
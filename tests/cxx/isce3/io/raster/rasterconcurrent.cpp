@@ -0,0 +1,82 @@
+#include <string>
+#include <valarray>
+#include <gtest/gtest.h>
+
+#include <isce3/core/Matrix.h>
+#include <isce3/io/ConcurrentRasterReader.h>
+#include <isce3/io/Raster.h>
+
+struct ConcurrentRasterReaderTest : public ::testing::Test {
+    const size_t nc = 120;  // number of columns
+    const size_t nl = 300;  // number of lines
+    const size_t nb = 10;   // lines per block
+
+    // Write a raster whose pixel values are their linear index
+    void createRaster(const std::string & filename, const std::string & driver) {
+        std::remove(filename.c_str());
+        isce3::io::Raster raster(filename, nc, nl, 1, GDT_Float32, driver);
+        std::valarray<float> data(nc * nl);
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = i;
+        }
+        raster.setBlock(data, 0, 0, nc, nl);
+    }
+
+    // Read all blocks from multiple threads and compare to expected values
+    void checkReads(isce3::io::ConcurrentRasterReader & reader) {
+        const int nblocks = nl / nb;
+        int nerrors = 0;
+        #pragma omp parallel for reduction(+:nerrors)
+        for (int block = 0; block < nblocks; ++block) {
+            // skip the first column to exercise offsets
+            isce3::core::Matrix<float> data(nb, nc - 1);
+            reader.getBlock(data, 1, block * nb);
+            for (size_t i = 0; i < nb; ++i) {
+                for (size_t j = 0; j < nc - 1; ++j) {
+                    if (data(i, j) != (block * nb + i) * nc + j + 1) {
+                        ++nerrors;
+                    }
+                }
+            }
+        }
+        ASSERT_EQ(nerrors, 0);
+    }
+};
+
+// Raw ENVI files are read through their memory map
+TEST_F(ConcurrentRasterReaderTest, ENVI) {
+    createRaster("concurrent.bin", "ENVI");
+    isce3::io::Raster raster("concurrent.bin");
+    isce3::io::ConcurrentRasterReader reader(raster);
+    ASSERT_EQ(reader.width(), nc);
+    ASSERT_EQ(reader.length(), nl);
+    checkReads(reader);
+
+    // reads converting datatype go through GDAL handles
+    isce3::core::Matrix<double> data(2, 3);
+    reader.getBlock(data, 4, 5);
+    ASSERT_EQ(data(1, 2), 6 * nc + 6);
+}
+
+// Read-only files are reopened so that threads read through their own handles
+TEST_F(ConcurrentRasterReaderTest, GTiff) {
+    createRaster("concurrent.tif", "GTiff");
+    isce3::io::Raster raster("concurrent.tif");
+    isce3::io::ConcurrentRasterReader reader(raster);
+    ASSERT_TRUE(reader.concurrent());
+    checkReads(reader);
+}
+
+// Rasters opened for update are read one thread at a time
+TEST_F(ConcurrentRasterReaderTest, Update) {
+    createRaster("concurrent_update.tif", "GTiff");
+    isce3::io::Raster raster("concurrent_update.tif", GA_Update);
+    isce3::io::ConcurrentRasterReader reader(raster);
+    ASSERT_FALSE(reader.concurrent());
+    checkReads(reader);
+}
+
+int main(int argc, char * argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,128 @@
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <isce3/core/Matrix.h>
+#include <isce3/io/OverviewBuilder.h>
+#include <isce3/io/Raster.h>
+
+struct OverviewBuilderTest : public ::testing::Test {
+    const size_t nc = 101;  // number of columns
+    const size_t nl = 77;   // number of lines
+    const size_t nb = 13;   // lines per block, not a multiple of the factors
+    const std::vector<int> factors = {2, 3, 8};
+
+    std::vector<float> data;
+
+    void SetUp() override {
+        data.resize(nc * nl);
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = (i * 37) % 101;
+        }
+        data[5 * nc + 7] = std::numeric_limits<float>::quiet_NaN();
+    }
+
+    // Write the data in blocks of lines from multiple threads, building the
+    // overviews along the way
+    void writeBlocks(const std::string & filename, const std::string & resampling) {
+        std::remove(filename.c_str());
+        isce3::io::Raster raster(filename, nc, nl, 1, GDT_Float32, "GTiff");
+        isce3::io::OverviewBuilder overviews(raster, factors, resampling);
+        const int nblocks = (nl + nb - 1) / nb;
+        #pragma omp parallel for
+        for (int block = 0; block < nblocks; ++block) {
+            const size_t length = std::min(nb, nl - block * nb);
+            isce3::core::Matrix<float> mat(length, nc);
+            std::copy(&data[block * nb * nc], &data[(block * nb + length) * nc],
+                      mat.data());
+            #pragma omp critical
+            {
+                raster.setBlock(mat, 0, block * nb);
+                overviews.addBlock(mat, 0, block * nb);
+            }
+        }
+    }
+
+    // Compare each overview level to its expected values
+    void checkOverviews(const std::string & filename, bool average) {
+        isce3::io::Raster raster(filename);
+        GDALRasterBand * band = raster.dataset()->GetRasterBand(1);
+        ASSERT_EQ(band->GetOverviewCount(), int(factors.size()));
+        for (size_t level = 0; level < factors.size(); ++level) {
+            const size_t f = factors[level];
+            GDALRasterBand * overview = band->GetOverview(level);
+            const size_t ow = overview->GetXSize();
+            const size_t ol = overview->GetYSize();
+            ASSERT_EQ(ow, (nc + f - 1) / f);
+            ASSERT_EQ(ol, (nl + f - 1) / f);
+
+            std::vector<float> values(ow * ol);
+            ASSERT_EQ(overview->RasterIO(GF_Read, 0, 0, ow, ol, values.data(),
+                                         ow, ol, GDT_Float32, 0, 0), CE_None);
+
+            for (size_t oy = 0; oy < ol; ++oy) {
+                for (size_t ox = 0; ox < ow; ++ox) {
+                    const size_t wy = std::min(f, nl - oy * f);
+                    const size_t wx = std::min(f, nc - ox * f);
+                    double expected;
+                    if (average) {
+                        double sum = 0;
+                        int count = 0;
+                        for (size_t y = oy * f; y < oy * f + wy; ++y) {
+                            for (size_t x = ox * f; x < ox * f + wx; ++x) {
+                                if (!std::isnan(data[y * nc + x])) {
+                                    sum += data[y * nc + x];
+                                    ++count;
+                                }
+                            }
+                        }
+                        expected = sum / count;
+                    } else {
+                        expected = data[(oy * f + wy / 2) * nc + ox * f + wx / 2];
+                    }
+                    ASSERT_NEAR(values[oy * ow + ox], expected, 1e-4);
+                }
+            }
+        }
+    }
+};
+
+TEST_F(OverviewBuilderTest, Average) {
+    writeBlocks("overview_average.tif", "AVERAGE");
+    checkOverviews("overview_average.tif", true);
+}
+
+TEST_F(OverviewBuilderTest, Nearest) {
+    writeBlocks("overview_nearest.tif", "nearest");
+    checkOverviews("overview_nearest.tif", false);
+}
+
+TEST_F(OverviewBuilderTest, InvalidArguments) {
+    std::remove("overview_invalid.tif");
+    isce3::io::Raster raster("overview_invalid.tif", nc, nl, 1, GDT_Float32, "GTiff");
+    ASSERT_THROW(isce3::io::OverviewBuilder(raster, {}),
+                 isce3::except::InvalidArgument);
+    ASSERT_THROW(isce3::io::OverviewBuilder(raster, {1, 2}),
+                 isce3::except::InvalidArgument);
+    ASSERT_THROW(isce3::io::OverviewBuilder(raster, {2}, "CUBIC"),
+                 isce3::except::InvalidArgument);
+
+    // Levels of the same dimensions: duplicate factors, or 5 x 4 pixels for
+    // both factors 21 and 22
+    ASSERT_THROW(isce3::io::OverviewBuilder(raster, {6, 2, 6}),
+                 isce3::except::InvalidArgument);
+    ASSERT_THROW(isce3::io::OverviewBuilder(raster, {21, 22}),
+                 isce3::except::InvalidArgument);
+
+    isce3::io::OverviewBuilder overviews(raster, {2});
+    std::vector<float> block(nc * 2);
+    ASSERT_THROW(overviews.addBlock(block.data(), 0, nl - 1, nc, 2),
+                 isce3::except::OutOfRange);
+}
+
+int main(int argc, char * argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,93 @@
+#include <cstddef>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <isce3/core/Matrix.h>
+#include <isce3/io/SlidingWindowCache.h>
+
+struct SlidingWindowCacheTest : public ::testing::Test {
+    const size_t width = 50;
+    const size_t length = 100;
+
+    std::vector<double> data;
+    std::vector<size_t> linesRead;
+
+    void SetUp() override {
+        data.resize(width * length);
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = i;
+        }
+        linesRead.assign(length, 0);
+    }
+
+    isce3::io::SlidingWindowCache<double> cache() {
+        return isce3::io::SlidingWindowCache<double>(
+                [this](double * block, size_t xoff, size_t yoff,
+                       size_t blockWidth, size_t blockLength) {
+                    for (size_t i = 0; i < blockLength; ++i) {
+                        ++linesRead[yoff + i];
+                        for (size_t j = 0; j < blockWidth; ++j) {
+                            block[i * blockWidth + j] =
+                                    data[(yoff + i) * width + xoff + j];
+                        }
+                    }
+                });
+    }
+
+    // Check a window against the data
+    void checkBlock(const isce3::core::Matrix<double> & block, size_t xoff,
+                    size_t yoff, size_t blockWidth, size_t blockLength) {
+        ASSERT_EQ(block.width(), blockWidth);
+        ASSERT_EQ(block.length(), blockLength);
+        for (size_t i = 0; i < blockLength; ++i) {
+            for (size_t j = 0; j < blockWidth; ++j) {
+                ASSERT_EQ(block(i, j), data[(yoff + i) * width + xoff + j]);
+            }
+        }
+    }
+};
+
+TEST_F(SlidingWindowCacheTest, SlidingLines) {
+    auto windows = cache();
+
+    // Overlapping windows sliding along the lines read each line once
+    for (size_t yoff = 0; yoff + 30 <= length; yoff += 10) {
+        checkBlock(windows.getBlock(5, yoff, 40, 30), 5, yoff, 40, 30);
+    }
+    for (size_t line = 0; line < length; ++line) {
+        ASSERT_EQ(linesRead[line], 1);
+    }
+    ASSERT_EQ(windows.pixelsRead(), 40 * length);
+
+    // Same window again
+    checkBlock(windows.getBlock(5, 70, 40, 30), 5, 70, 40, 30);
+    ASSERT_EQ(windows.pixelsRead(), 40 * length);
+}
+
+TEST_F(SlidingWindowCacheTest, ShiftedColumns) {
+    auto windows = cache();
+    checkBlock(windows.getBlock(10, 20, 20, 30), 10, 20, 20, 30);
+
+    // Overlapping window shifted across and along: only the pixels outside
+    // of the previous window are read
+    checkBlock(windows.getBlock(5, 30, 30, 30), 5, 30, 30, 30);
+    ASSERT_EQ(windows.pixelsRead(), 20 * 30 + 30 * 30 - 20 * 20);
+
+    // Window within the previous one
+    checkBlock(windows.getBlock(10, 35, 10, 10), 10, 35, 10, 10);
+    ASSERT_EQ(windows.pixelsRead(), 20 * 30 + 30 * 30 - 20 * 20);
+
+    // Disjoint window
+    checkBlock(windows.getBlock(0, 60, 50, 40), 0, 60, 50, 40);
+    ASSERT_EQ(windows.pixelsRead(), 20 * 30 + 30 * 30 - 20 * 20 + 50 * 40);
+
+    // Everything read again after clear
+    windows.clear();
+    checkBlock(windows.getBlock(0, 60, 50, 40), 0, 60, 50, 40);
+    ASSERT_EQ(windows.pixelsRead(), 20 * 30 + 30 * 30 - 20 * 20 + 2 * 50 * 40);
+}
+
+int main(int argc, char * argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,10 +1,12 @@
 #include <cmath> // cos, sin, sqrt, fmod
 #include <complex> // std::complex, std::arg
-#include <cstdint> // uint8_t
-#include <gtest/gtest.h> // TEST, ASSERT_EQ, ASSERT_TRUE, testing::InitGoogleTest, RUN_ALL_TESTS
+#include <cstdint> // uint8_t, uint32_t, UINT32_MAX
+#include <gtest/gtest.h> // TEST, ASSERT_EQ, ASSERT_TRUE, ASSERT_THROW, testing::InitGoogleTest, RUN_ALL_TESTS
+#include <stdexcept> // std::overflow_error
 #include <valarray> // std::valarray, std::abs
 
 #include "isce3/unwrap/icu/ICU.h" // isce3::unwrap::icu::ICU
+#include "isce3/unwrap/icu/LabelMap.h" // isce3::unwrap::icu::LabelMap
 #include "isce3/io/Raster.h" // isce3::io::Raster
 
 TEST(ICU, GetSetters)
@@ -47,6 +49,33 @@ TEST(ICU, GetSetters)
     ASSERT_EQ(icuobj.minBsPts(), 12);
     icuobj.bsPhaseVarThr(3.f);
     ASSERT_EQ(icuobj.bsPhaseVarThr(), 3.f);
+    icuobj.useParallelTiles(true);
+    ASSERT_EQ(icuobj.useParallelTiles(), true);
+}
+
+TEST(ICU, LabelMap)
+{
+    using isce3::unwrap::icu::label_t;
+
+    // 8-bit labels by default
+    isce3::unwrap::icu::LabelMap labelmap8;
+    for (int l = 1; l <= 255; ++l) { ASSERT_EQ(labelmap8.nextlabel(), l); }
+    ASSERT_THROW(labelmap8.nextlabel(), std::overflow_error);
+
+    // 32-bit labels
+    constexpr label_t n = 1000;
+    isce3::unwrap::icu::LabelMap labelmap(UINT32_MAX);
+    for (label_t l = 1; l <= n; ++l) { ASSERT_EQ(labelmap.nextlabel(), l); }
+    ASSERT_EQ(labelmap.size(), n + 1);
+
+    // Merge labels pairwise from the top down, then merge the even & odd 
+    // chains together. Every label should map to the min label.
+    for (label_t l = n; l > 2; --l) { labelmap.setlabel(l, l - 2); }
+    ASSERT_EQ(labelmap.getlabel(n), 2);
+    ASSERT_EQ(labelmap.getlabel(n - 1), 1);
+    labelmap.setlabel(n, n - 1);
+    for (label_t l = 1; l <= n; ++l) { ASSERT_EQ(labelmap.getlabel(l), 1); }
+    ASSERT_EQ(labelmap.getlabel(0), 0);
 }
 
 TEST(ICU, ResidueCalculation)
@@ -291,6 +320,78 @@ TEST(ICU, CheckConnCompLabels)
     ASSERT_TRUE((ccl == refccl).min());
 }
 
+TEST(ICU, RunICUParallelTiles)
+{
+    // Read interferogram, correlation from prior test.
+    isce3::io::Raster intfRaster("./intf");
+    isce3::io::Raster corrRaster("./corr");
+    const size_t l = intfRaster.length();
+    const size_t w = intfRaster.width();
+
+    // Unwrap the same 3 tiles in parallel and stitch them together.
+    isce3::io::Raster unwRaster("./unw_par", w, l, 1, GDT_Float32, "ENVI");
+    isce3::io::Raster cclRaster("./ccl_par", w, l, 1, GDT_Byte, "ENVI");
+
+    isce3::unwrap::icu::ICU icuobj;
+    icuobj.numBufLines(400);
+    icuobj.numOverlapLines(50);
+    icuobj.useParallelTiles(true);
+
+    icuobj.unwrap(unwRaster, cclRaster, intfRaster, corrRaster);
+
+    isce3::io::Raster refUnwRaster("./unw");
+    isce3::io::Raster refCclRaster("./ccl");
+    std::valarray<float> unw(l*w), refunw(l*w);
+    std::valarray<uint8_t> ccl(l*w), refccl(l*w);
+    unwRaster.getBlock(unw, 0, 0, w, l);
+    cclRaster.getBlock(ccl, 0, 0, w, l);
+    refUnwRaster.getBlock(refunw, 0, 0, w, l);
+    refCclRaster.getBlock(refccl, 0, 0, w, l);
+
+    // Results should match away from the overlaps between tiles: the lines
+    // of an overlap are taken from the next tile by sequential processing,
+    // but split at their midpoint between both tiles by parallel processing,
+    // and branch cuts near the edges of a tile may differ.
+    const size_t step = 400 - 50;
+    for (size_t j = 0; j < l; ++j)
+    {
+        if (j >= step && j % step < 50) { continue; }
+        for (size_t i = 0; i < w; ++i)
+        {
+            ASSERT_EQ(ccl[j * w + i], refccl[j * w + i]);
+            ASSERT_NEAR(unw[j * w + i], refunw[j * w + i], 1e-5);
+        }
+    }
+}
+
+TEST(ICU, RunICU32BitLabels)
+{
+    // Read interferogram, correlation from prior test.
+    isce3::io::Raster intfRaster("./intf");
+    isce3::io::Raster corrRaster("./corr");
+    const size_t l = intfRaster.length();
+    const size_t w = intfRaster.width();
+
+    // Labels are 32-bit if the output raster type is.
+    isce3::io::Raster unwRaster("./unw_u32", w, l, 1, GDT_Float32, "ENVI");
+    isce3::io::Raster cclRaster("./ccl_u32", w, l, 1, GDT_UInt32, "ENVI");
+
+    isce3::unwrap::icu::ICU icuobj;
+    icuobj.numBufLines(400);
+    icuobj.numOverlapLines(50);
+
+    icuobj.unwrap(unwRaster, cclRaster, intfRaster, corrRaster);
+
+    // Labels should match 8-bit processing.
+    isce3::io::Raster refCclRaster("./ccl");
+    std::valarray<uint32_t> ccl(l*w);
+    std::valarray<uint8_t> refccl(l*w);
+    cclRaster.getBlock(ccl, 0, 0, w, l);
+    refCclRaster.getBlock(refccl, 0, 0, w, l);
+
+    for (size_t i = 0; i < l*w; ++i) { ASSERT_EQ(ccl[i], refccl[i]); }
+}
+
 int main(int argc, char * argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -2,12 +2,15 @@
 #include <complex> // std::complex, std::arg
 #include <cstdint> // uint8_t
 #include <gtest/gtest.h> // TEST, ASSERT_EQ, ASSERT_TRUE, testing::InitGoogleTest, RUN_ALL_TE  STS
+#include <string> // std::string
 #include <valarray> // std::valarray, std::abs
 
 #include "isce3/unwrap/phass/Phass.h" // isce3::unwrap::phass::Phass
 #include "isce3/io/Raster.h" // isce3::io::Raster
 
-void runPhass();
+void runPhass(const std::string & suffix = "", const size_t memoryBudget = 0,
+              const int numThreads = 1);
+void checkPhass(const std::string & suffix);
 
 TEST(Phass, GetSetters)
 {
@@ -23,13 +26,120 @@ TEST(Phass, GetSetters)
     phassObj.minPixelsPerRegion(100);
     ASSERT_EQ(phassObj.minPixelsPerRegion(), 100);
 
+    phassObj.memoryBudget(1 << 30);
+    ASSERT_EQ(phassObj.memoryBudget(), 1 << 30);
+
+    phassObj.numOverlapLines(50);
+    ASSERT_EQ(phassObj.numOverlapLines(), 50);
+
+    phassObj.numThreads(4);
+    ASSERT_EQ(phassObj.numThreads(), 4);
+
 }
 
 
 TEST(Phass, CheckConnCompLabels)
 {
     runPhass();
+    checkPhass("");
+}
+
+TEST(Phass, CheckConnCompLabelsTiled)
+{
+    // Memory budget for tiles of 400 lines. With 200 lines of overlap the
+    // 1100 lines are processed as 5 tiles.
+    const size_t memoryBudget = 400 * 64 * 256;
+    isce3::unwrap::phass::Phass phassObj;
+    phassObj.memoryBudget(memoryBudget);
+    ASSERT_EQ(phassObj.numTiles(1100, 256), 5);
+    ASSERT_EQ(phassObj.numTiles(400, 256), 1);
+
+    runPhass("_tiled", memoryBudget);
+    checkPhass("_tiled");
+}
+
+TEST(Phass, TiledByteLabels)
+{
+    constexpr size_t l = 1100;
+    constexpr size_t w = 256;
+
+    // Vertical stripes of good correlation spanning the scene, each one a 
+    // connected component
+    constexpr size_t stripeWidth = 8;
+    constexpr size_t nstripes = w / (2 * stripeWidth);
+
+    std::valarray<float> phase(l*w), corr(l*w);
+    for (size_t j = 0; j < l; ++j)
+    {
+        float y = float(j) / float(l) * 50.f;
+        std::complex<float> z{cosf(y), sinf(y)};
+        for (size_t i = 0; i < w; ++i)
+        {
+            phase[j * w + i] = std::arg(z);
+            if ((i / stripeWidth) % 2 == 1) { corr[j * w + i] = 1.f; }
+        }
+    }
+
+    isce3::io::Raster wrappedPhaseRaster("./intf_byte", w, l, 1, GDT_Float32, "ENVI");
+    wrappedPhaseRaster.setBlock(phase, 0, 0, w, l);
+    isce3::io::Raster corrRaster("./corr_byte", w, l, 1, GDT_Float32, "ENVI");
+    corrRaster.setBlock(corr, 0, 0, w, l);
+
+    // Tiles of 100 lines with 50 lines of overlap. Every tile numbers its 
+    // own regions, so there are more intermediate region ids than a byte 
+    // can hold, while the final labels fit.
+    isce3::unwrap::phass::Phass phassObj;
+    phassObj.memoryBudget(100 * 64 * w);
+    phassObj.numOverlapLines(50);
+    const int ntiles = phassObj.numTiles(l, w);
+    ASSERT_EQ(ntiles, 21);
+    ASSERT_GT(ntiles * nstripes, 255);
 
+    {
+        isce3::io::Raster unwRaster("./unw_byte", w, l, 1, GDT_Float32, "ENVI");
+        isce3::io::Raster labelsRaster("./labels_byte", w, l, 1, GDT_Byte, "ENVI");
+        phassObj.unwrap(wrappedPhaseRaster, corrRaster, unwRaster, labelsRaster);
+    }
+
+    isce3::io::Raster unwRaster("./unw_byte");
+    std::valarray<float> unw(l*w);
+    unwRaster.getBlock(unw, 0, 0, w, l);
+    isce3::io::Raster labelsRaster("./labels_byte");
+    std::valarray<uint8_t> ccl(l*w);
+    labelsRaster.getBlock(ccl, 0, 0, w, l);
+
+    std::valarray<int> stripeLabel(0, nstripes);
+    for (size_t s = 0; s < nstripes; ++s)
+    {
+        const size_t i0 = (2 * s + 1) * stripeWidth;
+        stripeLabel[s] = ccl[i0];
+        ASSERT_NE(stripeLabel[s], 0);
+        for (size_t s2 = 0; s2 < s; ++s2) { ASSERT_NE(stripeLabel[s2], stripeLabel[s]); }
+
+        for (size_t j = 0; j < l; ++j)
+        {
+            for (size_t i = i0; i < i0 + stripeWidth; ++i)
+            {
+                // Each stripe has a single label and no cycle jumps.
+                ASSERT_EQ(ccl[j * w + i], stripeLabel[s]);
+                ASSERT_LT(std::abs(std::sin(unw[j * w + i] - phase[j * w + i])), 1e-5);
+                if (j > 0)
+                {
+                    ASSERT_LT(std::abs(unw[j * w + i] - unw[(j - 1) * w + i]), M_PI);
+                }
+            }
+        }
+    }
+}
+
+TEST(Phass, CheckConnCompLabelsParallel)
+{
+    runPhass("_parallel", 0, 4);
+    checkPhass("_parallel");
+}
+
+void checkPhass(const std::string & suffix)
+{
     constexpr size_t l = 1100;
     constexpr size_t w = 256;
 
@@ -61,11 +171,11 @@ TEST(Phass, CheckConnCompLabels)
 
 
     // Read connected component labels from prior test.
-    isce3::io::Raster cclRasterOut("./labels");
+    isce3::io::Raster cclRasterOut("./labels" + suffix);
     ASSERT_TRUE(cclRasterOut.length() == l && cclRasterOut.width() == w);
 
     // Read unwrapped phase from prior test.
-    isce3::io::Raster outputUnwRaster("./unw");
+    isce3::io::Raster outputUnwRaster("./unw" + suffix);
     ASSERT_TRUE(outputUnwRaster.length() == l && outputUnwRaster.width() == w);
     std::valarray<float> unw(l*w);
     outputUnwRaster.getBlock(unw, 0, 0, w, l);
@@ -95,7 +205,8 @@ int main(int argc, char * argv[])
     return RUN_ALL_TESTS();
 }
 
-void runPhass() {
+void runPhass(const std::string & suffix, const size_t memoryBudget,
+              const int numThreads) {
 
     constexpr size_t l = 1100;
     constexpr size_t w = 256;
@@ -134,11 +245,13 @@ void runPhass() {
     corrRaster.setBlock(corr, 0, 0, w, l);
 
     // Init output unwrapped phase, connected component labels rasters
-    isce3::io::Raster unwRaster("./unw", w, l, 1, GDT_Float32, "ENVI");
-    isce3::io::Raster labelsRaster("./labels", w, l, 1, GDT_Int32, "ENVI");
+    isce3::io::Raster unwRaster("./unw" + suffix, w, l, 1, GDT_Float32, "ENVI");
+    isce3::io::Raster labelsRaster("./labels" + suffix, w, l, 1, GDT_Int32, "ENVI");
 
     // Configure Phass.
     isce3::unwrap::phass::Phass phassObj;
+    phassObj.memoryBudget(memoryBudget);
+    phassObj.numThreads(numThreads);
 
     //unwrap the interferogram
     phassObj.unwrap(wrappedPhaseRaster, corrRaster, unwRaster, labelsRaster);
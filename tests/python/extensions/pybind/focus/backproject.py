@@ -2,6 +2,8 @@
 
 import h5py
 import numpy as np
+import numpy.testing as npt
+from osgeo import gdal
 import pybind_isce3 as isce
 from iscetest import data as test_data_dir
 from pathlib import Path
@@ -157,3 +159,96 @@ def test_backproject():
     # threshold is slightly higher - see
     # https://github.jpl.nasa.gov/bhawkins/nisar-notebooks/blob/master/Azimuth%20Resolution.ipynb
     assert(azimuth_width <= 6.62)
+
+def test_backproject_tiled():
+    # load point target simulation data
+    filename = Path(test_data_dir) / "point-target-sim-rc.h5"
+    d = load_h5(filename)
+
+    radar_grid = d["radar_grid"]
+    orbit = d["orbit"]
+    doppler = d["doppler"]
+    range_sampling_rate = d["range_sampling_rate"]
+
+    # small output chip centered on the target that is not a multiple of the
+    # tile size
+    nchip = 37
+
+    kernel = isce.core.KnabKernel(9., 20e6 / range_sampling_rate)
+    kernel = isce.core.TabulatedKernelF32(kernel, 2048)
+
+    dt = radar_grid.az_time_interval
+    dr = radar_grid.range_pixel_spacing
+    t0 = d["target_azimuth"] - 0.5 * (nchip - 1) * dt
+    r0 = d["target_range"] - 0.5 * (nchip - 1) * dr
+    out_grid = isce.product.RadarGridParameters(
+            t0, radar_grid.wavelength, radar_grid.prf, r0, dr,
+            radar_grid.lookside, nchip, nchip, orbit.reference_epoch)
+
+    in_geometry = isce.container.RadarGeometry(radar_grid, orbit, doppler)
+    out_geometry = isce.container.RadarGeometry(out_grid, orbit, doppler)
+
+    args = (out_geometry, d["signal_data"], in_geometry, d["dem"],
+            d["center_frequency"], 6., kernel, d["dry_tropo_model"])
+
+    # untiled reference result
+    ref = np.empty((nchip, nchip), np.complex64)
+    isce.focus.backproject(ref, *args)
+
+    # tiled result should agree to within rdr2geo/geo2rdr tolerance
+    out = np.empty((nchip, nchip), np.complex64)
+    tile_params = dict(azimuth_tile=8, range_tile=16, pulse_block=50)
+    isce.focus.backproject(out, *args, tile_params=tile_params)
+
+    npt.assert_allclose(out, ref, rtol=1e-4, atol=1e-4 * np.abs(ref).max())
+
+def test_backproject_raster(tmp_path):
+    # load point target simulation data
+    filename = Path(test_data_dir) / "point-target-sim-rc.h5"
+    d = load_h5(filename)
+
+    radar_grid = d["radar_grid"]
+    orbit = d["orbit"]
+    doppler = d["doppler"]
+    signal_data = d["signal_data"]
+
+    # write range-compressed data to disk
+    lines, samples = signal_data.shape
+    fname = str(tmp_path / "backproject_rc.bin")
+    ds = gdal.GetDriverByName("ENVI").Create(fname, samples, lines, 1,
+            gdal.GDT_CFloat32)
+    ds.GetRasterBand(1).WriteArray(signal_data)
+    ds = None
+
+    nchip = 37
+
+    kernel = isce.core.KnabKernel(9., 20e6 / d["range_sampling_rate"])
+    kernel = isce.core.TabulatedKernelF32(kernel, 2048)
+
+    dt = radar_grid.az_time_interval
+    dr = radar_grid.range_pixel_spacing
+    t0 = d["target_azimuth"] - 0.5 * (nchip - 1) * dt
+    r0 = d["target_range"] - 0.5 * (nchip - 1) * dr
+    out_grid = isce.product.RadarGridParameters(
+            t0, radar_grid.wavelength, radar_grid.prf, r0, dr,
+            radar_grid.lookside, nchip, nchip, orbit.reference_epoch)
+
+    in_geometry = isce.container.RadarGeometry(radar_grid, orbit, doppler)
+    out_geometry = isce.container.RadarGeometry(out_grid, orbit, doppler)
+
+    tile_params = dict(azimuth_tile=8, range_tile=16, pulse_block=50)
+
+    # in-memory reference result
+    ref = np.empty((nchip, nchip), np.complex64)
+    isce.focus.backproject(ref, out_geometry, signal_data, in_geometry,
+            d["dem"], d["center_frequency"], 6., kernel, d["dry_tropo_model"],
+            tile_params=tile_params)
+
+    # streaming from raster should give identical results
+    out = np.empty((nchip, nchip), np.complex64)
+    raster = isce.io.Raster(fname)
+    isce.focus.backproject(out, out_geometry, raster, in_geometry,
+            d["dem"], d["center_frequency"], 6., kernel, d["dry_tropo_model"],
+            tile_params=tile_params)
+
+    npt.assert_array_equal(out, ref)
@@ -24,3 +24,39 @@ def test_rangecomp():
     y = np.zeros_like(x)
     rc.rangecompress(y, x)
     assert np.allclose(y, x)
+
+def test_rangecomp_real_decimated():
+    nchirp, ndata, dec = 1, 8, 2
+    h = np.ones(nchirp, dtype='c8')
+
+    rc = focus.RangeComp(h, ndata, decimation=dec, real_input=True)
+
+    assert rc.decimation == dec
+    assert rc.real_input
+    assert rc.fft_size % 4 == 0
+    assert rc.output_size == (nchirp + ndata - 1 + dec - 1) // dec
+
+    x = np.zeros(ndata, dtype='f4')
+    y = np.ones(rc.output_size, dtype='c8')
+    rc.rangecompress(y, x)
+    assert np.allclose(y, 0.0)
+
+def test_parallel_rangecomp():
+    nchirp = ndata = 1
+    npulses = 10
+    h = np.ones(nchirp, dtype='c8')
+
+    rc = focus.ParallelRangeComp(h, ndata, batch=3, threads=2)
+
+    assert rc.chirp_size == nchirp
+    assert rc.input_size == ndata
+    assert rc.mode == focus.RangeComp.Mode.Full
+    assert rc.batch == 3
+    assert rc.threads == 2
+    assert rc.decimation == 1
+    assert rc.output_size == nchirp + ndata - 1
+
+    x = np.arange(npulses, dtype='c8').reshape((npulses, 1))
+    y = np.zeros_like(x)
+    rc.rangecompress(y, x)
+    assert np.allclose(y, x)
@@ -40,3 +40,28 @@ def test_methods():
         dem = m.DEMInterpolator(method="TigerKing")
 
     # TODO Test other methods once we have isce::io::Raster bindings.
+
+
+def test_tile_cache():
+    from pathlib import Path
+    from iscetest import data as test_data_dir
+    from pybind_isce3.io import Raster
+
+    cache = m.DEMTileCache.instance()
+    budget = cache.memory_budget
+    try:
+        cache.memory_budget = 64 * 1024 * 1024
+        assert cache.memory_budget == 64 * 1024 * 1024
+
+        raster = Raster(str(Path(test_data_dir) / "srtm_cropped.tif"))
+        dem = m.DEMInterpolator()
+        dem.load_dem(raster)
+        assert cache.memory_usage > 0
+
+        # release the tiles
+        cache.clear()
+        assert cache.memory_usage == 0
+        assert cache.hits == 0
+        assert cache.misses == 0
+    finally:
+        cache.memory_budget = budget